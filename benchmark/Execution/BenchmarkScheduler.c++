@@ -0,0 +1,216 @@
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/Execution/Executor.h++"
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/IO/Print.h++"
+#include "Mustard/Math/Random/Distribution/Exponential.h++"
+#include "Mustard/Math/Random/Distribution/Uniform.h++"
+#include "Mustard/Math/Random/Generator/SplitMix64.h++"
+
+#include "mplr/mplr.hpp"
+
+#include "fmt/format.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Usage: mpirun -n <N> MustardBenchmarkScheduler <result.json|result.csv> [mean task time (us)] [number of tasks]
+//
+// overhead: empty tasks, per-task cost of scheduling
+// strong:   fixed number of tasks, run with different N for strong scaling
+// weak:     number of tasks proportional to N, for weak scaling
+// Task durations are drawn per task ID (identical for all schedulers) from a
+// constant, exponential or heavy-tailed (Pareto, alpha = 1.5) distribution,
+// and tasks busy-wait for their duration.
+
+using namespace Mustard;
+using namespace std::chrono_literals;
+
+using Seconds = std::chrono::duration<double>;
+
+enum struct DurationDistribution {
+    Constant,
+    Exponential,
+    HeavyTailed
+};
+
+auto ToString(DurationDistribution distribution) -> std::string_view {
+    switch (distribution) {
+    case DurationDistribution::Constant:
+        return "constant";
+    case DurationDistribution::Exponential:
+        return "exponential";
+    case DurationDistribution::HeavyTailed:
+        return "heavy-tailed";
+    }
+    return {};
+}
+
+auto TaskDuration(DurationDistribution distribution, Seconds mean, int taskID) -> Seconds {
+    Math::Random::SplitMix64 random{static_cast<std::uint64_t>(taskID)};
+    switch (distribution) {
+    case DurationDistribution::Constant:
+        return mean;
+    case DurationDistribution::Exponential:
+        return Seconds{Math::Random::Exponential<double>{mean.count()}(random)};
+    case DurationDistribution::HeavyTailed: {
+        constexpr auto alpha{1.5};
+        const auto u{1 - Math::Random::Uniform<double>{}(random)};
+        return mean * (alpha - 1) / alpha * std::pow(u, -1 / alpha);
+    }
+    }
+    return {};
+}
+
+auto Spin(Seconds duration) -> void {
+    const auto end{std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(duration)};
+    while (std::chrono::steady_clock::now() < end) {}
+}
+
+struct Result {
+    std::string scheduler;
+    std::string_view benchmark;
+    std::string_view distribution;
+    int nProcess;
+    int nTask;
+    double meanTaskTime;
+    double wallTime;
+    double efficiency;
+    double overheadPerTask;
+    double taskDurationP99;
+    double schedulerTime;
+    double idleTailTime;
+    unsigned long long nMessage;
+};
+
+auto Run(std::string_view scheduler, std::string_view benchmark, DurationDistribution distribution, Seconds mean, int nTask) -> Result {
+    Executor<int> executor{"Benchmark", "Task", scheduler};
+    executor.PrintProgress(false);
+    // the overhead benchmark runs without the per-task clock reads of profiling
+    executor.Profile(benchmark != "overhead");
+    std::vector<Seconds> duration(nTask);
+    for (int i{}; i < nTask; ++i) {
+        duration[i] = mean == Seconds::zero() ? Seconds::zero() : TaskDuration(distribution, mean, i);
+    }
+    Seconds totalWork{};
+    for (auto&& t : duration) {
+        totalWork += t;
+    }
+    executor(nTask, [&](int i) {
+        if (duration[i] > Seconds::zero()) {
+            Spin(duration[i]);
+        }
+    });
+    const auto& info{executor.ExecutionInfo()};
+    const auto nProcess{executor.NProcess()};
+    const auto wallTime{Seconds{info.wallTime}.count()};
+    return {.scheduler = std::string{scheduler},
+            .benchmark = benchmark,
+            .distribution = ToString(distribution),
+            .nProcess = nProcess,
+            .nTask = nTask,
+            .meanTaskTime = mean.count(),
+            .wallTime = wallTime,
+            .efficiency = totalWork.count() / (nProcess * wallTime),
+            .overheadPerTask = (nProcess * wallTime - totalWork.count()) / nTask,
+            .taskDurationP99 = Seconds{info.taskDuration.p99}.count(),
+            .schedulerTime = Seconds{info.schedulerTime}.count(),
+            .idleTailTime = Seconds{info.idleTailTime}.count(),
+            .nMessage = info.nMessage};
+}
+
+auto Write(const std::filesystem::path& path, const std::vector<Result>& resultList) -> void {
+    std::ofstream os{path};
+    if (not os.is_open()) {
+        PrintError(fmt::format("Cannot open {}", path.string()));
+        return;
+    }
+    if (path.extension() == ".csv") {
+        os << "scheduler,benchmark,distribution,nProcess,nTask,meanTaskTime,wallTime,efficiency,"
+              "overheadPerTask,taskDurationP99,schedulerTime,idleTailTime,nMessage\n";
+        for (auto&& r : resultList) {
+            os << fmt::format("{},{},{},{},{},{},{},{},{},{},{},{},{}\n",
+                              r.scheduler, r.benchmark, r.distribution, r.nProcess, r.nTask, r.meanTaskTime, r.wallTime,
+                              r.efficiency, r.overheadPerTask, r.taskDurationP99, r.schedulerTime, r.idleTailTime, r.nMessage);
+        }
+        return;
+    }
+    os << "[";
+    for (bool first{true}; auto&& r : resultList) {
+        os << (first ? "\n  " : ",\n  ")
+           << fmt::format(R"({{"scheduler": "{}", "benchmark": "{}", "distribution": "{}", "nProcess": {}, "nTask": {}, )"
+                          R"("meanTaskTime": {}, "wallTime": {}, "efficiency": {}, "overheadPerTask": {}, "taskDurationP99": {}, )"
+                          R"("schedulerTime": {}, "idleTailTime": {}, "nMessage": {}}})",
+                          r.scheduler, r.benchmark, r.distribution, r.nProcess, r.nTask, r.meanTaskTime, r.wallTime,
+                          r.efficiency, r.overheadPerTask, r.taskDurationP99, r.schedulerTime, r.idleTailTime, r.nMessage);
+        first = false;
+    }
+    os << "\n]\n";
+}
+
+auto main(int argc, char* argv[]) -> int {
+    Env::MPIEnv env{argc, argv, {}};
+
+    if (argc < 2) {
+        MasterPrintLn("Usage: {} <result.json|result.csv> [mean task time (us)] [number of tasks]", argv[0]);
+        return EXIT_FAILURE;
+    }
+    const std::filesystem::path output{argv[1]};
+    const Seconds mean{std::chrono::microseconds{argc > 2 ? std::stoi(argv[2]) : 100}};
+    const auto nProcess{mplr::comm_world().size()};
+    const auto nTask{argc > 3 ? std::stoi(argv[3]) : 10000};
+
+    std::vector<std::string_view> schedulerList;
+    if (nProcess == 1) {
+        schedulerList.emplace_back("seq");
+    }
+    schedulerList.emplace_back("stat");
+    if (env.OnSingleNode()) {
+        schedulerList.emplace_back("shm");
+    }
+    schedulerList.insert(schedulerList.end(), {"mw", "clmw", "hshm", "ws"});
+
+    std::vector<Result> resultList;
+    const auto Record{[&](Result result) {
+        MasterPrintLn("{:5} {:9} {:12} N = {:3} tasks = {:7} wall = {:8.4f} s eff. = {:6.3f} overhead = {:9.3e} s/task idle tail = {:8.4f} s",
+                      result.scheduler, result.benchmark, result.distribution, result.nProcess, result.nTask,
+                      result.wallTime, result.efficiency, result.overheadPerTask, result.idleTailTime);
+        resultList.emplace_back(std::move(result));
+    }};
+    for (auto&& scheduler : schedulerList) {
+        Record(Run(scheduler, "overhead", DurationDistribution::Constant, Seconds::zero(), 100 * nTask));
+        for (auto distribution : {DurationDistribution::Constant, DurationDistribution::Exponential, DurationDistribution::HeavyTailed}) {
+            Record(Run(scheduler, "strong", distribution, mean, nTask));
+            Record(Run(scheduler, "weak", distribution, mean, nTask / 10 * nProcess));
+        }
+    }
+
+    if (mplr::comm_world().rank() == 0) {
+        Write(output, resultList);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,396 @@
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/CLHEPX/Random/MersenneTwister.h++"
+#include "Mustard/CLHEPX/Random/Philox.h++"
+#include "Mustard/CLHEPX/Random/Xoshiro.h++"
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/IO/Print.h++"
+#include "Mustard/Math/Random/Distribution/Discrete.h++"
+#include "Mustard/Math/Random/Distribution/Exponential.h++"
+#include "Mustard/Math/Random/Distribution/Gaussian.h++"
+#include "Mustard/Math/Random/Distribution/Gaussian2DDiagnoal.h++"
+#include "Mustard/Math/Random/Distribution/Gaussian3DDiagnoal.h++"
+#include "Mustard/Math/Random/Distribution/Piecewise.h++"
+#include "Mustard/Math/Random/Distribution/Uniform.h++"
+#include "Mustard/Math/Random/Distribution/UniformDisk.h++"
+#include "Mustard/Math/Random/Distribution/UniformRectangle.h++"
+#include "Mustard/Math/Random/Generator/MT1993732.h++"
+#include "Mustard/Math/Random/Generator/MT1993764.h++"
+#include "Mustard/Math/Random/Generator/Philox4x64.h++"
+#include "Mustard/Math/Random/Generator/SplitMix64.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro256Plus.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro256PlusPlus.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro256PlusPlusX.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro256StarStar.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro512Plus.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro512PlusPlus.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro512StarStar.h++"
+#include "Mustard/ROOTX/Math/Philox.h++"
+#include "Mustard/ROOTX/Math/Xoshiro.h++"
+
+#include "CLHEP/Random/RandomEngine.h"
+
+#include "TRandom.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <numbers>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Usage: MustardBenchmarkRandom [result.json|result.csv] [log2 of number of samples per test]
+//
+// Engines: ns per 32 random bits, per uniform double and per uniform double in
+// bulk (Uniform<double>::Generate, CLHEP flatArray, ROOT RndmArray), then
+// p-values of a built-in battery of empirical tests:
+//   birthday spacings: Marsaglia's test on the top 32 bits, 4096 birthdays per
+//                      sample (lambda = 4), Poisson count of duplicate spacings
+//   gap:               Knuth's gap test of uniform doubles on [1/4, 5/16)
+//   serial:            lag-1 serial correlation of uniform doubles
+//   frequency:         chi-square of the top 8 bits
+// A p-value below 1e-6 is a failure, below 1e-3 is suspicious (expected to
+// happen once in a thousand tests by chance).
+// CLHEPX and ROOTX wrappers provide doubles only; their 32 bits are the top
+// 32 bits of flat() and Rndm().
+//
+// Distributions: ns per sample by operator() and by Generate, with
+// Xoshiro256PlusPlus.
+
+using namespace Mustard;
+
+struct Result {
+    std::string_view category;
+    std::string name;
+    std::string_view metric;
+    double value;
+};
+
+// two-sided p-value of a standard normal z
+auto NormalP(double z) -> double {
+    return std::erfc(std::abs(z) / std::numbers::sqrt2);
+}
+
+// p-value of chi-square (upper tail) by the Wilson-Hilferty transformation
+auto ChiSquareP(double chi2, int ndf) -> double {
+    const auto v{2. / (9 * ndf)};
+    const auto z{(std::cbrt(chi2 / ndf) - (1 - v)) / std::sqrt(v)};
+    return std::erfc(z / std::numbers::sqrt2) / 2;
+}
+
+auto BirthdaySpacings(auto& engine, long long n) -> double {
+    constexpr auto nBirthday{4096};
+    constexpr auto lambda{static_cast<double>(nBirthday) * nBirthday * nBirthday / 4 / 0x1p32};
+    const auto nSample{std::max(1ll, n / nBirthday)};
+    std::vector<std::uint32_t> birthday(nBirthday);
+    std::vector<std::uint32_t> spacing(nBirthday);
+    long long nDuplicate{};
+    for (long long i{}; i < nSample; ++i) {
+        for (auto&& b : birthday) {
+            b = engine.Bits();
+        }
+        std::ranges::sort(birthday);
+        std::adjacent_difference(birthday.begin(), birthday.end(), spacing.begin());
+        std::ranges::sort(spacing);
+        for (int j{1}; j < nBirthday; ++j) {
+            nDuplicate += spacing[j] == spacing[j - 1];
+        }
+    }
+    const auto mean{nSample * lambda};
+    return NormalP((nDuplicate - mean) / std::sqrt(mean));
+}
+
+auto Gap(auto& engine, long long n) -> double {
+    constexpr auto alpha{0.25};
+    constexpr auto beta{0.3125};
+    constexpr auto p{beta - alpha};
+    constexpr auto t{64};
+    std::vector<double> count(t + 1);
+    long long gap{};
+    for (long long i{}; i < n; ++i) {
+        const auto u{engine.Flat()};
+        if (alpha <= u and u < beta) {
+            ++count[std::min<long long>(gap, t)];
+            gap = 0;
+        } else {
+            ++gap;
+        }
+    }
+    const auto nGap{std::reduce(count.begin(), count.end())};
+    auto chi2{0.};
+    for (int r{}; r <= t; ++r) {
+        const auto expected{nGap * (r < t ? p * std::pow(1 - p, r) : std::pow(1 - p, t))};
+        chi2 += (count[r] - expected) * (count[r] - expected) / expected;
+    }
+    return ChiSquareP(chi2, t);
+}
+
+auto Serial(auto& engine, long long n) -> double {
+    const auto first{engine.Flat()};
+    auto previous{first};
+    auto sum{first};
+    auto sum2{first * first};
+    auto sumProduct{0.};
+    for (long long i{1}; i < n; ++i) {
+        const auto u{engine.Flat()};
+        sum += u;
+        sum2 += u * u;
+        sumProduct += previous * u;
+        previous = u;
+    }
+    sumProduct += previous * first; // circular
+    const auto r{(n * sumProduct - sum * sum) / (n * sum2 - sum * sum)};
+    // E[r] = -1/(n - 1), Var[r] ~ 1/n
+    return NormalP((r + 1. / (n - 1)) * std::sqrt(static_cast<double>(n)));
+}
+
+auto Frequency(auto& engine, long long n) -> double {
+    std::vector<double> count(256);
+    for (long long i{}; i < n; ++i) {
+        ++count[engine.Bits() >> 24];
+    }
+    const auto expected{n / 256.};
+    auto chi2{0.};
+    for (auto&& c : count) {
+        chi2 += (c - expected) * (c - expected) / expected;
+    }
+    return ChiSquareP(chi2, 255);
+}
+
+// defeats dead code elimination
+volatile double sink;
+
+// ns per call
+auto TimePerCall(long long n, auto&& F) -> double {
+    using Clock = std::chrono::steady_clock;
+    auto sum{0.};
+    const auto start{Clock::now()};
+    for (long long i{}; i < n; ++i) {
+        const auto x{F()};
+        if constexpr (std::is_arithmetic_v<decltype(x)>) {
+            sum += x;
+        } else {
+            sum += x[0];
+        }
+    }
+    const auto time{std::chrono::duration<double, std::nano>{Clock::now() - start}.count()};
+    sink = sum;
+    return time / n;
+}
+
+// ns per element of a filled buffer
+auto TimePerElement(long long n, auto&& Fill, auto& buffer) -> double {
+    using Clock = std::chrono::steady_clock;
+    auto sum{0.};
+    const auto nFill{std::max(1ll, n / static_cast<long long>(buffer.size()))};
+    const auto start{Clock::now()};
+    for (long long i{}; i < nFill; ++i) {
+        Fill(std::span{buffer});
+        if constexpr (std::is_arithmetic_v<std::ranges::range_value_t<decltype(buffer)>>) {
+            sum += buffer[i % buffer.size()];
+        } else {
+            sum += buffer[i % buffer.size()][0];
+        }
+    }
+    const auto time{std::chrono::duration<double, std::nano>{Clock::now() - start}.count()};
+    sink = sum;
+    return time / (nFill * buffer.size());
+}
+
+template<Math::Random::UniformPseudoRandomBitGenerator G>
+class MustardEngine {
+public:
+    auto Bits() -> std::uint32_t {
+        constexpr auto shift{std::bit_width(G::Max() - G::Min()) - 32};
+        return static_cast<std::uint32_t>((fEngine() - G::Min()) >> shift);
+    }
+    auto Flat() -> double { return Math::Random::Uniform<double>{}(fEngine); }
+    auto FlatArray(std::span<double> out) -> void { Math::Random::Uniform<double>{}.Generate(fEngine, out); }
+
+private:
+    G fEngine;
+};
+
+template<std::derived_from<CLHEP::HepRandomEngine> E>
+class CLHEPEngine {
+public:
+    auto Bits() -> std::uint32_t { return static_cast<std::uint32_t>(Flat() * 0x1p32); }
+    auto Flat() -> double { return fEngine.flat(); }
+    auto FlatArray(std::span<double> out) -> void { fEngine.flatArray(out.size(), out.data()); }
+
+private:
+    E fEngine;
+};
+
+template<std::derived_from<TRandom> E>
+class ROOTEngine {
+public:
+    auto Bits() -> std::uint32_t { return static_cast<std::uint32_t>(Flat() * 0x1p32); }
+    auto Flat() -> double { return fEngine.Rndm(); }
+    auto FlatArray(std::span<double> out) -> void { fEngine.RndmArray(out.size(), out.data()); }
+
+private:
+    E fEngine;
+};
+
+template<typename E>
+auto BenchmarkEngine(std::string_view name, long long n, std::vector<Result>& resultList) -> void {
+    const auto Record{[&](std::string_view metric, double value) {
+        resultList.push_back({"engine", std::string{name}, metric, value});
+        return value;
+    }};
+    const auto Flag{[](double p) { return p < 1e-6 ? "FAIL" : p < 1e-3 ? "????" : ""; }};
+    E engine;
+    std::vector<double> buffer(4096);
+    const auto nsBits{Record("nsPerBits", TimePerCall(n, [&] { return engine.Bits(); }))};
+    const auto nsFlat{Record("nsPerFlat", TimePerCall(n, [&] { return engine.Flat(); }))};
+    const auto nsBulk{Record("nsPerFlatBulk", TimePerElement(n, [&](auto out) { engine.FlatArray(out); }, buffer))};
+    const auto pBirthday{Record("pBirthdaySpacings", BirthdaySpacings(engine, n))};
+    const auto pGap{Record("pGap", Gap(engine, n))};
+    const auto pSerial{Record("pSerial", Serial(engine, n))};
+    const auto pFrequency{Record("pFrequency", Frequency(engine, n))};
+    PrintLn("{:36} {:7.3f} {:7.3f} {:7.3f}   {:9.3e}{:4} {:9.3e}{:4} {:9.3e}{:4} {:9.3e}{:4}",
+            name, nsBits, nsFlat, nsBulk,
+            pBirthday, Flag(pBirthday), pGap, Flag(pGap), pSerial, Flag(pSerial), pFrequency, Flag(pFrequency));
+}
+
+template<Math::Random::RandomNumberDistribution D>
+auto BenchmarkDistribution(std::string_view name, D distribution, long long n, std::vector<Result>& resultList) -> void {
+    Math::Random::Xoshiro256PlusPlus xoshiro256PP;
+    std::vector<typename D::ResultType> buffer(4096);
+    const auto ns{TimePerCall(n, [&] { return distribution(xoshiro256PP); })};
+    const auto nsBulk{TimePerElement(n, [&](auto out) { distribution.Generate(xoshiro256PP, out); }, buffer)};
+    resultList.push_back({"distribution", std::string{name}, "nsPerSample", ns});
+    resultList.push_back({"distribution", std::string{name}, "nsPerSampleBulk", nsBulk});
+    PrintLn("{:36} {:7.3f} {:7.3f}", name, ns, nsBulk);
+}
+
+auto Write(const std::filesystem::path& path, const std::vector<Result>& resultList) -> void {
+    std::ofstream os{path};
+    if (not os.is_open()) {
+        PrintError(fmt::format("Cannot open {}", path.string()));
+        return;
+    }
+    if (path.extension() == ".csv") {
+        os << "category,name,metric,value\n";
+        for (auto&& r : resultList) {
+            os << fmt::format("{},\"{}\",{},{}\n", r.category, r.name, r.metric, r.value);
+        }
+        return;
+    }
+    os << "[";
+    for (bool first{true}; auto&& r : resultList) {
+        os << (first ? "\n  " : ",\n  ")
+           << fmt::format(R"({{"category": "{}", "name": "{}", "metric": "{}", "value": {}}})",
+                          r.category, r.name, r.metric, r.value);
+        first = false;
+    }
+    os << "\n]\n";
+}
+
+auto main(int argc, char* argv[]) -> int {
+    const auto n{1ll << (argc > 2 ? std::stoi(argv[2]) : 24)};
+    std::vector<Result> resultList;
+
+    PrintLn("{:36} {:>7} {:>7} {:>7}   {:13} {:13} {:13} {:13}",
+            "Engine (ns per call; p-value)", "bits", "flat", "bulk", "birthday", "gap", "serial", "frequency");
+    using namespace Math::Random;
+    BenchmarkEngine<MustardEngine<MT1993732>>("MT1993732", n, resultList);
+    BenchmarkEngine<MustardEngine<MT1993764>>("MT1993764", n, resultList);
+    BenchmarkEngine<MustardEngine<Philox4x64>>("Philox4x64", n, resultList);
+    BenchmarkEngine<MustardEngine<SplitMix64>>("SplitMix64", n, resultList);
+    BenchmarkEngine<MustardEngine<Xoshiro256Plus>>("Xoshiro256Plus", n, resultList);
+    BenchmarkEngine<MustardEngine<Xoshiro256PlusPlus>>("Xoshiro256PlusPlus", n, resultList);
+    BenchmarkEngine<MustardEngine<Xoshiro256StarStar>>("Xoshiro256StarStar", n, resultList);
+    BenchmarkEngine<MustardEngine<Xoshiro512Plus>>("Xoshiro512Plus", n, resultList);
+    BenchmarkEngine<MustardEngine<Xoshiro512PlusPlus>>("Xoshiro512PlusPlus", n, resultList);
+    BenchmarkEngine<MustardEngine<Xoshiro512StarStar>>("Xoshiro512StarStar", n, resultList);
+    BenchmarkEngine<MustardEngine<Xoshiro256PlusPlusX2>>("Xoshiro256PlusPlusX2", n, resultList);
+    BenchmarkEngine<MustardEngine<Xoshiro256PlusPlusX4>>("Xoshiro256PlusPlusX4", n, resultList);
+    BenchmarkEngine<MustardEngine<Xoshiro256PlusPlusX8>>("Xoshiro256PlusPlusX8", n, resultList);
+    BenchmarkEngine<CLHEPEngine<CLHEPX::Random::MT1993732>>("CLHEPX::Random::MT1993732", n, resultList);
+    BenchmarkEngine<CLHEPEngine<CLHEPX::Random::MT1993764>>("CLHEPX::Random::MT1993764", n, resultList);
+    BenchmarkEngine<CLHEPEngine<CLHEPX::Random::Philox4x64>>("CLHEPX::Random::Philox4x64", n, resultList);
+    BenchmarkEngine<CLHEPEngine<CLHEPX::Random::Xoshiro256Plus>>("CLHEPX::Random::Xoshiro256Plus", n, resultList);
+    BenchmarkEngine<CLHEPEngine<CLHEPX::Random::Xoshiro256PlusPlus>>("CLHEPX::Random::Xoshiro256PlusPlus", n, resultList);
+    BenchmarkEngine<CLHEPEngine<CLHEPX::Random::Xoshiro256StarStar>>("CLHEPX::Random::Xoshiro256StarStar", n, resultList);
+    BenchmarkEngine<CLHEPEngine<CLHEPX::Random::Xoshiro512Plus>>("CLHEPX::Random::Xoshiro512Plus", n, resultList);
+    BenchmarkEngine<CLHEPEngine<CLHEPX::Random::Xoshiro512PlusPlus>>("CLHEPX::Random::Xoshiro512PlusPlus", n, resultList);
+    BenchmarkEngine<CLHEPEngine<CLHEPX::Random::Xoshiro512StarStar>>("CLHEPX::Random::Xoshiro512StarStar", n, resultList);
+    BenchmarkEngine<CLHEPEngine<CLHEPX::Random::Xoshiro256PlusPlusX4>>("CLHEPX::Random::Xoshiro256PlusPlusX4", n, resultList);
+    BenchmarkEngine<ROOTEngine<ROOTX::Math::Philox4x64>>("ROOTX::Math::Philox4x64", n, resultList);
+    BenchmarkEngine<ROOTEngine<ROOTX::Math::Xoshiro256Plus>>("ROOTX::Math::Xoshiro256Plus", n, resultList);
+    BenchmarkEngine<ROOTEngine<ROOTX::Math::Xoshiro256PlusPlus>>("ROOTX::Math::Xoshiro256PlusPlus", n, resultList);
+    BenchmarkEngine<ROOTEngine<ROOTX::Math::Xoshiro256StarStar>>("ROOTX::Math::Xoshiro256StarStar", n, resultList);
+    BenchmarkEngine<ROOTEngine<ROOTX::Math::Xoshiro512Plus>>("ROOTX::Math::Xoshiro512Plus", n, resultList);
+    BenchmarkEngine<ROOTEngine<ROOTX::Math::Xoshiro512PlusPlus>>("ROOTX::Math::Xoshiro512PlusPlus", n, resultList);
+    BenchmarkEngine<ROOTEngine<ROOTX::Math::Xoshiro512StarStar>>("ROOTX::Math::Xoshiro512StarStar", n, resultList);
+
+    // a spectrum-like shape of 1000 bins on [0, 10)
+    std::vector<double> x(1001);
+    std::vector<double> density(1001);
+    for (std::size_t i{}; i < x.size(); ++i) {
+        x[i] = i / 100.;
+        density[i] = std::exp(-x[i] / 3) * (1.2 + std::sin(5 * x[i]));
+    }
+    const std::span weight{density.begin(), density.end() - 1};
+
+    PrintLn("");
+    PrintLn("{:36} {:>7} {:>7}", "Distribution (ns per sample)", "call", "bulk");
+    BenchmarkDistribution("UniformCompact<double>", UniformCompact<double>{}, n, resultList);
+    BenchmarkDistribution("Uniform<double>", Uniform<double>{}, n, resultList);
+    BenchmarkDistribution("Uniform<float>", Uniform<float>{}, n, resultList);
+    BenchmarkDistribution("Uniform<int>", Uniform<int>{0, 999}, n, resultList);
+    BenchmarkDistribution("Gaussian<double>", Gaussian<double>{}, n, resultList);
+    BenchmarkDistribution("GaussianFast<double>", GaussianFast<double>{}, n, resultList);
+    BenchmarkDistribution("GaussianZiggurat<double>", GaussianZiggurat<double>{}, n, resultList);
+    BenchmarkDistribution("Exponential<double>", Exponential<double>{}, n, resultList);
+    BenchmarkDistribution("ExponentialFast<double>", ExponentialFast<double>{}, n, resultList);
+    BenchmarkDistribution("ExponentialZiggurat<double>", ExponentialZiggurat<double>{}, n, resultList);
+    BenchmarkDistribution("Gaussian2DDiagnoal", Gaussian2DDiagnoal{}, n, resultList);
+    BenchmarkDistribution("Gaussian2DDiagnoalFast", Gaussian2DDiagnoalFast{}, n, resultList);
+    BenchmarkDistribution("Gaussian3DDiagnoal", Gaussian3DDiagnoal{}, n, resultList);
+    BenchmarkDistribution("Gaussian3DDiagnoalFast", Gaussian3DDiagnoalFast{}, n, resultList);
+    BenchmarkDistribution("UniformCompactDisk", UniformCompactDisk{}, n, resultList);
+    BenchmarkDistribution("UniformDisk", UniformDisk{}, n, resultList);
+    BenchmarkDistribution("UniformCompactRectangle", UniformCompactRectangle{}, n, resultList);
+    BenchmarkDistribution("UniformRealRectangle", UniformRealRectangle{}, n, resultList);
+    BenchmarkDistribution("UniformIntegerRectangle", UniformIntegerRectangle{}, n, resultList);
+    BenchmarkDistribution("Discrete (1000 bins)", Discrete<int>{weight}, n, resultList);
+    BenchmarkDistribution("PiecewiseConstant (1000 bins)", PiecewiseConstant<double>{x, weight}, n, resultList);
+    BenchmarkDistribution("PiecewiseLinear (1000 bins)", PiecewiseLinear<double>{x, density}, n, resultList);
+
+    if (argc > 1) {
+        Write(argv[1], resultList);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,112 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/CLHEPX/Random/Wrap.h++"
+#include "Mustard/Math/Random/Distribution/Uniform.h++"
+#include "Mustard/Math/Random/UniformPseudoRandomBitGenerator.h++"
+#include "Mustard/Utility/FunctionAttribute.h++"
+
+#include "muc/utility"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <span>
+#include <string>
+#include <typeinfo>
+
+namespace Mustard::CLHEPX::Random {
+
+/// @brief Adapter for Mustard RNGs to CLHEP random engine interface, serving
+/// flat() from a block of pre-generated numbers
+///
+/// The block is refilled by Math::Random::Uniform<double>::Generate, i.e. by
+/// the bulk interface of the PRBG when available (e.g.
+/// Math::Random::Xoshiro256PlusPlusX). flat() is then an index increment and
+/// flatArray() a copy. The sequence of flat() equals that of
+/// Uniform<double>::Generate on the PRBG, thus equals that of Wrap<PRBG> for
+/// PRBGs without bulk interface. Buffering pays off with a bulk (vectorized)
+/// PRBG; otherwise generating a block costs as much as calling flat() on Wrap.
+///
+/// @tparam PRBG Mustard UniformPseudoRandomBitGenerator type to wrap
+/// @tparam NBuffer Number of doubles in the block
+///
+/// @note put() saves the state the block was generated from plus the cursor
+/// in the block, so get() restores the exact sequence of flat(), flatArray()
+/// and the conversion operators.
+/// @warning The block is discarded by setSeed(), setSeeds() and the non-const
+/// Engine() of this class. Modifying the PRBG through Wrap<PRBG>::Engine()
+/// without reseeding leaves the rest of the old block in use.
+template<Math::Random::UniformPseudoRandomBitGenerator PRBG, std::size_t NBuffer = 512>
+    requires(NBuffer > 0)
+class BufferedWrap : public Wrap<PRBG> {
+public:
+    /// @brief Construct with default seed
+    BufferedWrap();
+    /// @brief Construct with specific seed
+    /// @param seed Initialization value (converted to PRBG::SeedType)
+    explicit BufferedWrap(long seed);
+
+    /// @brief Generate uniform double in 0--1
+    MUSTARD_ALWAYS_INLINE virtual auto flat() -> double override;
+    /// @brief Fill array with uniform doubles
+    /// @param size Number of values to generate
+    /// @param vect Pre-allocated output buffer
+    virtual auto flatArray(const int size, double* vect) -> void override;
+
+    /// @brief Seed the engine (single seed), discarding the block
+    virtual auto setSeed(long seed, int = 0) -> void override;
+    /// @brief Seed the engine (seed array), discarding the block
+    virtual auto setSeeds(const long* seeds, int = 0) -> void override;
+
+    /// @brief Get engine type name
+    /// @return Demangled type name of this wrapper
+    virtual auto name() const -> std::string override { return muc::try_demangle(typeid(BufferedWrap).name()); }
+
+    /// @brief Serialize engine state (including the cursor) to output stream
+    virtual auto put(std::ostream& os) const -> decltype(os) override;
+    /// @brief Deserialize engine state (including the cursor) from input stream
+    virtual auto get(std::istream& is) -> decltype(is) override;
+
+    using Wrap<PRBG>::Engine;
+    /// @brief Access the wrapped PRBG, discarding the block
+    auto Engine() -> PRBG&;
+
+    /// @name Random-number-generating conversion operators, all served from
+    /// the block as in CLHEP::HepRandomEngine
+    /// @{
+    virtual operator double() override { return flat(); }
+    virtual operator float() override { return static_cast<float>(flat()); }
+    virtual operator unsigned int() override { return static_cast<unsigned int>(flat() * 0x1p32); }
+    /// @}
+
+private:
+    auto Refill() -> void;
+
+private:
+    alignas(64) std::array<double, NBuffer> fBuffer;
+    std::size_t fCursor;
+    PRBG fBufferOrigin;
+};
+
+} // namespace Mustard::CLHEPX::Random
+
+#include "Mustard/CLHEPX/Random/BufferedWrap.inl"
@@ -0,0 +1,127 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::CLHEPX::Random {
+
+template<Math::Random::UniformPseudoRandomBitGenerator PRBG, std::size_t NBuffer>
+    requires(NBuffer > 0)
+BufferedWrap<PRBG, NBuffer>::BufferedWrap() :
+    Wrap<PRBG>{},
+    fBuffer{},
+    fCursor{NBuffer},
+    fBufferOrigin{} {}
+
+template<Math::Random::UniformPseudoRandomBitGenerator PRBG, std::size_t NBuffer>
+    requires(NBuffer > 0)
+BufferedWrap<PRBG, NBuffer>::BufferedWrap(long seed) :
+    Wrap<PRBG>{seed},
+    fBuffer{},
+    fCursor{NBuffer},
+    fBufferOrigin{} {}
+
+template<Math::Random::UniformPseudoRandomBitGenerator PRBG, std::size_t NBuffer>
+    requires(NBuffer > 0)
+MUSTARD_ALWAYS_INLINE auto BufferedWrap<PRBG, NBuffer>::flat() -> double {
+    if (fCursor == NBuffer) [[unlikely]] {
+        Refill();
+    }
+    return fBuffer[fCursor++];
+}
+
+template<Math::Random::UniformPseudoRandomBitGenerator PRBG, std::size_t NBuffer>
+    requires(NBuffer > 0)
+auto BufferedWrap<PRBG, NBuffer>::flatArray(const int size, double* vect) -> void {
+    std::span out{vect, static_cast<std::size_t>(std::max(size, 0))};
+    const auto nBuffered{std::min(out.size(), NBuffer - fCursor)};
+    std::copy_n(fBuffer.begin() + fCursor, nBuffered, out.begin());
+    fCursor += nBuffered;
+    // the block is used up, continue the same sequence directly in the output
+    if (const auto rest{out.subspan(nBuffered)};
+        not rest.empty()) {
+        Math::Random::Uniform<double>{}.Generate(Wrap<PRBG>::Engine(), rest);
+    }
+}
+
+template<Math::Random::UniformPseudoRandomBitGenerator PRBG, std::size_t NBuffer>
+    requires(NBuffer > 0)
+auto BufferedWrap<PRBG, NBuffer>::setSeed(long seed, int) -> void {
+    Wrap<PRBG>::setSeed(seed);
+    fCursor = NBuffer;
+}
+
+template<Math::Random::UniformPseudoRandomBitGenerator PRBG, std::size_t NBuffer>
+    requires(NBuffer > 0)
+auto BufferedWrap<PRBG, NBuffer>::setSeeds(const long* seeds, int) -> void {
+    Wrap<PRBG>::setSeeds(seeds);
+    fCursor = NBuffer;
+}
+
+template<Math::Random::UniformPseudoRandomBitGenerator PRBG, std::size_t NBuffer>
+    requires(NBuffer > 0)
+auto BufferedWrap<PRBG, NBuffer>::put(std::ostream& os) const -> decltype(os) {
+    const auto engineName = name();
+    os << engineName << "-begin\n"
+       << (fCursor == NBuffer ? Engine() : fBufferOrigin) << '\n'
+       << fCursor << '\n'
+       << engineName << "-end\n";
+    return os;
+}
+
+template<Math::Random::UniformPseudoRandomBitGenerator PRBG, std::size_t NBuffer>
+    requires(NBuffer > 0)
+auto BufferedWrap<PRBG, NBuffer>::get(std::istream& is) -> decltype(is) {
+    const auto engineName = name();
+    std::string tag;
+    is >> tag;
+    if (tag != std::string(engineName).append("-begin")) {
+        std::cerr << "BufferedWrap<PRBG>::get (with PRBG = " << muc::try_demangle(typeid(PRBG).name()) << "): No " << engineName << " found at current position, engine state unchanged. Input stream has been consumed\n";
+        return is;
+    }
+    PRBG volunteer;
+    std::size_t cursor{NBuffer + 1};
+    is >> volunteer >> cursor >> tag;
+    if (tag != std::string(engineName).append("-end") or cursor > NBuffer) {
+        std::cerr << "BufferedWrap<PRBG>::get (with PRBG = " << muc::try_demangle(typeid(PRBG).name()) << "): " << engineName << " read from the input stream is incomplete, engine state unchanged. Input stream has been consumed\n";
+        return is;
+    }
+    Wrap<PRBG>::Engine() = volunteer;
+    fCursor = NBuffer;
+    if (cursor != NBuffer) {
+        Refill();
+        fCursor = cursor;
+    }
+    return is;
+}
+
+template<Math::Random::UniformPseudoRandomBitGenerator PRBG, std::size_t NBuffer>
+    requires(NBuffer > 0)
+auto BufferedWrap<PRBG, NBuffer>::Engine() -> PRBG& {
+    fCursor = NBuffer;
+    return Wrap<PRBG>::Engine();
+}
+
+template<Math::Random::UniformPseudoRandomBitGenerator PRBG, std::size_t NBuffer>
+    requires(NBuffer > 0)
+auto BufferedWrap<PRBG, NBuffer>::Refill() -> void {
+    auto& engine{Wrap<PRBG>::Engine()};
+    fBufferOrigin = engine;
+    Math::Random::Uniform<double>{}.Generate(engine, fBuffer);
+    fCursor = 0;
+}
+
+} // namespace Mustard::CLHEPX::Random
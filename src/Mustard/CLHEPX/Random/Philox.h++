@@ -0,0 +1,28 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/CLHEPX/Random/Wrap.h++"
+#include "Mustard/Math/Random/Generator/Philox4x64.h++"
+
+namespace Mustard::CLHEPX::Random {
+
+using Philox4x64 = CLHEPX::Random::Wrap<Math::Random::Philox4x64>;
+
+} // namespace Mustard::CLHEPX::Random
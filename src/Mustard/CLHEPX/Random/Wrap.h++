@@ -95,6 +95,11 @@ public:
     /// @brief Deserialize engine state from input stream
     virtual auto get(std::istream& is) -> decltype(is) override;
 
+    /// @brief Wrapped PRBG
+    auto Engine() const -> const PRBG& { return fPRBG; }
+    /// @brief Access the wrapped PRBG, e.g. to select a stream of a counter-based generator
+    auto Engine() -> PRBG& { return fPRBG; }
+
     /// @name Random-number-generating conversion operators
     /// @{
     virtual operator double() override { return Math::Random::Uniform<double>()(fPRBG); }
@@ -18,9 +18,11 @@
 
 #pragma once
 
+#include "Mustard/CLHEPX/Random/BufferedWrap.h++"
 #include "Mustard/CLHEPX/Random/Wrap.h++"
 #include "Mustard/Math/Random/Generator/Xoshiro256Plus.h++"
 #include "Mustard/Math/Random/Generator/Xoshiro256PlusPlus.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro256PlusPlusX.h++"
 #include "Mustard/Math/Random/Generator/Xoshiro256StarStar.h++"
 #include "Mustard/Math/Random/Generator/Xoshiro512Plus.h++"
 #include "Mustard/Math/Random/Generator/Xoshiro512PlusPlus.h++"
@@ -35,4 +37,8 @@ using Xoshiro512StarStar = CLHEPX::Random::Wrap<Math::Random::Xoshiro512StarStar
 using Xoshiro512PlusPlus = CLHEPX::Random::Wrap<Math::Random::Xoshiro512PlusPlus>;
 using Xoshiro512Plus = CLHEPX::Random::Wrap<Math::Random::Xoshiro512Plus>;
 
+using Xoshiro256PlusPlusX2 = CLHEPX::Random::BufferedWrap<Math::Random::Xoshiro256PlusPlusX2>;
+using Xoshiro256PlusPlusX4 = CLHEPX::Random::BufferedWrap<Math::Random::Xoshiro256PlusPlusX4>;
+using Xoshiro256PlusPlusX8 = CLHEPX::Random::BufferedWrap<Math::Random::Xoshiro256PlusPlusX8>;
+
 } // namespace Mustard::CLHEPX::Random
@@ -19,8 +19,11 @@
 #pragma once
 
 #include "Mustard/Data/RDFEventSplit.h++"
+#include "Mustard/Data/SequentialRDataFrame.h++"
 #include "Mustard/Data/Tuple.h++"
+#include "Mustard/Data/TupleBatch.h++"
 #include "Mustard/Data/TupleModel.h++"
+#include "Mustard/Data/internal/BatchArena.h++"
 #include "Mustard/Data/internal/ReadHelper.h++"
 #include "Mustard/IO/PrettyLog.h++"
 #include "Mustard/Utility/NonCopyableBase.h++"
@@ -29,6 +32,7 @@
 #include "ROOT/RDataFrame.hxx"
 #include "RtypesCore.h"
 #include "TROOT.h"
+#include "TTreeCacheUnzip.h"
 
 #include "muc/concepts"
 #include "muc/ptrvec"
@@ -40,14 +44,20 @@
 
 #include <atomic>
 #include <concepts>
+#include <condition_variable>
 #include <cstddef>
+#include <deque>
 #include <functional>
 #include <future>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <numeric>
 #include <optional>
-#include <semaphore>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <stop_token>
 #include <thread>
 #include <tuple>
 #include <type_traits>
@@ -57,6 +67,22 @@
 
 namespace Mustard::Data {
 
+/// @brief Reads batches of data from a RDataFrame in a background thread.
+///
+/// Reads are queued in a bounded ring: up to Depth() batches can be requested
+/// before the oldest is acquired, and the reader thread runs through them in
+/// order. Requested batches must be ordered and must not overlap, since the
+/// underlying RDataFrame loop runs only once. A new read is also refused when
+/// the batches being read exceed the memory budget, estimated from the
+/// in-memory size of the entries.
+///
+/// The RDataFrame must have a sequential event loop. If ROOT implicit
+/// multithreading is enabled, construct it by SequentialRDataFrame, then
+/// baskets are still decompressed in parallel.
+///
+/// Destroying the reader stops the event loop at the next batch boundary, and
+/// discards the reads not acquired. Derived classes whose members are used by
+/// the read loop must call Stop() in their destructor.
 template<typename AData>
 class AsyncReader : public NonCopyableBase {
 public:
@@ -70,13 +96,31 @@ public:
     [[nodiscard]] virtual auto Acquire() -> AData;
     virtual auto Exhaust() -> void;
 
-    auto Reading() const -> auto { return fReading; }
+    auto Depth() const -> auto { return fDepth; }
+    auto Depth(int n) -> void;
+    auto MemoryBudget() const -> auto { return fMemoryBudget; }
+    auto MemoryBudget(std::size_t bytes) -> void { fMemoryBudget = bytes; }
+
+    auto Reading() const -> bool { return not fReadingBytes.empty(); }
+    auto NReading() const -> auto { return std::ssize(fReadingBytes); }
+    auto Full() const -> bool;
     auto Exhausted() const -> auto { return fExhausted.load(); }
 
 protected:
     auto First() const -> auto { return fFirst; };
     auto Last() const -> auto { return fLast; };
     auto CompleteRead() -> void;
+    /// @brief Stop the event loop and join the reader thread. Idempotent.
+    auto Stop() -> void;
+    /// @brief Estimated memory of the data of a batch.
+    virtual auto BatchBytes(gsl::index first, gsl::index last) const -> std::size_t = 0;
+
+private:
+    /// @brief Thrown out of the event loop by StartRead once stop is requested.
+    struct StopRequested {};
+
+    auto StartRead() -> void;
+    auto CompleteAllRead() -> void;
 
 protected:
     AData fData;
@@ -86,17 +130,42 @@ private:
     gsl::index fLast;
 
     gsl::index fSentinel;
-    std::jthread fReaderThread;
-    std::binary_semaphore fStartReadSemaphore;
-    std::binary_semaphore fCompleteReadSemaphore;
+    int fDepth;
+    std::size_t fMemoryBudget;
+    std::deque<std::size_t> fReadingBytes;
+    gsl::index fRequestedLast;
+
+    std::mutex fMutex;
+    std::condition_variable_any fCondition;
+    std::deque<std::pair<gsl::index, gsl::index>> fRequested;
+    std::deque<AData> fCompleted;
     std::atomic_bool fExhausted;
-    bool fReading;
+    std::stop_token fStopToken;
+
+    std::jthread fReaderThread;
 };
 
 template<TupleModelizable... Ts>
 class AsyncEntryReader : public AsyncReader<muc::shared_ptrvec<Tuple<Ts...>>> {
 public:
     AsyncEntryReader(ROOT::RDF::RNode dataFrame);
+    ~AsyncEntryReader();
+
+protected:
+    virtual auto BatchBytes(gsl::index first, gsl::index last) const -> std::size_t override;
+
+private:
+    std::shared_ptr<internal::BatchArena<Tuple<Ts...>>> fArena;
+};
+
+template<TupleModelizable... Ts>
+class AsyncBatchReader : public AsyncReader<TupleBatch<Ts...>> {
+public:
+    AsyncBatchReader(ROOT::RDF::RNode dataFrame);
+    ~AsyncBatchReader();
+
+protected:
+    virtual auto BatchBytes(gsl::index first, gsl::index last) const -> std::size_t override;
 };
 
 template<std::integral AEventIDType, muc::instantiated_from<TupleModel>... Ts>
@@ -115,11 +184,16 @@ class AsyncEventReader<AEventIDType, TupleModel<Ts...>> : public AsyncReader<std
 public:
     AsyncEventReader(ROOT::RDF::RNode dataFrame, std::string eventIDColumnName);
     AsyncEventReader(ROOT::RDF::RNode dataFrame, std::vector<gsl::index> eventSplit);
+    ~AsyncEventReader();
 
     virtual auto Read(gsl::index first, gsl::index last) -> void override;
 
+protected:
+    virtual auto BatchBytes(gsl::index first, gsl::index last) const -> std::size_t override;
+
 private:
     std::vector<gsl::index> fEventSplit;
+    std::shared_ptr<internal::BatchArena<Tuple<Ts...>>> fArena;
 };
 
 } // namespace Mustard::Data
@@ -25,32 +25,48 @@ AsyncReader<AData>::AsyncReader(gsl::index sentinel, std::function<void(ROOT::RD
     fFirst{},
     fLast{},
     fSentinel{sentinel},
-    fReaderThread{},
-    fStartReadSemaphore{0},
-    fCompleteReadSemaphore{0},
+    fDepth{1},
+    fMemoryBudget{std::numeric_limits<std::size_t>::max()},
+    fReadingBytes{},
+    fRequestedLast{},
+    fMutex{},
+    fCondition{},
+    fRequested{},
+    fCompleted{},
     fExhausted{},
-    fReading{} {
+    fStopToken{},
+    fReaderThread{} {
+    if (rdf.GetNSlots() > 1) {
+        Throw<std::logic_error>("Async RDataFrame reader requires a sequential event loop "
+                                "(construct the RDataFrame by SequentialRDataFrame if IMT is enabled)");
+    }
     if (ROOT::IsImplicitMTEnabled()) {
-        Throw<std::logic_error>("Async RDataFrame reader cannot be used with IMT enabled");
+        // entries are still read in order, baskets are decompressed on the IMT thread pool
+        TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::kEnable);
     }
     fReaderThread = std::jthread{
-        [this](std::function<void(ROOT::RDF::RNode)> ReadLoop, ROOT::RDF::RNode rdf) {
+        [this](std::stop_token stopToken, std::function<void(ROOT::RDF::RNode)> ReadLoop, ROOT::RDF::RNode rdf) {
+            fStopToken = std::move(stopToken);
             if (fSentinel == 0) {
                 fExhausted = true;
                 return;
             }
-            fStartReadSemaphore.acquire();
-            std::invoke(std::move(ReadLoop), std::move(rdf));
-            fExhausted = true;
-            fCompleteReadSemaphore.release();
+            try {
+                StartRead();
+                std::invoke(std::move(ReadLoop), std::move(rdf));
+            } catch (const StopRequested&) {
+                return; // reader abandoned, skip the rest
+            }
+            CompleteAllRead();
         },
         std::move(ReadLoop), std::move(rdf)};
 }
 
 template<typename AData>
 AsyncReader<AData>::~AsyncReader() {
-    if (fReading) {
-        Throw<std::logic_error>("Last read data not acquired");
+    Stop();
+    if (Reading()) {
+        PrintWarning(fmt::format("{} read(s) not acquired, discarded", NReading()));
     }
     if (not fExhausted) {
         PrintWarning("Data have not been exhausted");
@@ -59,8 +75,8 @@ AsyncReader<AData>::~AsyncReader() {
 
 template<typename AData>
 auto AsyncReader<AData>::Read(gsl::index first, gsl::index last) -> void {
-    if (fReading) {
-        Throw<std::logic_error>("Try to start another read while reading");
+    if (Full()) {
+        Throw<std::logic_error>(fmt::format("Try to start another read while {} reads are pending", NReading()));
     }
     if (fExhausted) {
         Throw<std::logic_error>("Data have been exhausted");
@@ -74,34 +90,101 @@ auto AsyncReader<AData>::Read(gsl::index first, gsl::index last) -> void {
     if (first > last) {
         Throw<std::out_of_range>("first > last");
     }
-    fFirst = first;
-    fLast = last;
-    fData.reserve(last - first);
-    fReading = true;
-    fStartReadSemaphore.release();
+    if (first < fRequestedLast) {
+        Throw<std::out_of_range>("first < last of the previous read");
+    }
+    {
+        const std::scoped_lock lock{fMutex};
+        if (fExhausted) {
+            Throw<std::logic_error>("Data have been exhausted");
+        }
+        fRequested.emplace_back(first, last);
+    }
+    fCondition.notify_all();
+    fRequestedLast = last;
+    fReadingBytes.emplace_back(BatchBytes(first, last));
 }
 
 template<typename AData>
 [[nodiscard]] auto AsyncReader<AData>::Acquire() -> AData {
-    if (not fReading) {
+    if (not Reading()) {
         Throw<std::logic_error>("Try to acquire result while not reading");
     }
-    fCompleteReadSemaphore.acquire();
-    fReading = false;
-    return std::move(fData);
+    std::unique_lock lock{fMutex};
+    fCondition.wait(lock, [this] { return not fCompleted.empty(); });
+    auto data{std::move(fCompleted.front())};
+    fCompleted.pop_front();
+    lock.unlock();
+    fReadingBytes.pop_front();
+    return data;
 }
 
 template<typename AData>
 auto AsyncReader<AData>::Exhaust() -> void {
+    if (Reading()) {
+        Throw<std::logic_error>("Try to exhaust while reading");
+    }
     Read(fSentinel, fSentinel);
     Ensures(Acquire().empty());
 }
 
+template<typename AData>
+auto AsyncReader<AData>::Depth(int n) -> void {
+    if (n < 1) {
+        Throw<std::invalid_argument>(fmt::format("Depth ({}) < 1", n));
+    }
+    fDepth = n;
+}
+
+template<typename AData>
+auto AsyncReader<AData>::Full() const -> bool {
+    return NReading() >= fDepth or
+           (Reading() and std::reduce(fReadingBytes.cbegin(), fReadingBytes.cend()) >= fMemoryBudget);
+}
+
 template<typename AData>
 auto AsyncReader<AData>::CompleteRead() -> void {
-    fCompleteReadSemaphore.release();
-    fStartReadSemaphore.acquire();
-    fData.clear();
+    {
+        const std::scoped_lock lock{fMutex};
+        fCompleted.emplace_back(std::move(fData));
+    }
+    fCondition.notify_all();
+    fData = AData{};
+    StartRead();
+}
+
+template<typename AData>
+auto AsyncReader<AData>::Stop() -> void {
+    if (fReaderThread.joinable()) {
+        fReaderThread.request_stop();
+        fReaderThread.join();
+    }
+}
+
+template<typename AData>
+auto AsyncReader<AData>::StartRead() -> void {
+    std::unique_lock lock{fMutex};
+    if (not fCondition.wait(lock, fStopToken, [this] { return not fRequested.empty(); }) or
+        fStopToken.stop_requested()) {
+        throw StopRequested{}; // caught in the reader thread, aborts the event loop
+    }
+    std::tie(fFirst, fLast) = fRequested.front();
+    fRequested.pop_front();
+    lock.unlock();
+    fData.reserve(fLast - fFirst);
+}
+
+template<typename AData>
+auto AsyncReader<AData>::CompleteAllRead() -> void {
+    {
+        const std::scoped_lock lock{fMutex};
+        fExhausted = true;
+        fCompleted.emplace_back(std::move(fData));
+        for (; not fRequested.empty(); fRequested.pop_front()) {
+            fCompleted.emplace_back();
+        }
+    }
+    fCondition.notify_all();
 }
 
 template<TupleModelizable... Ts>
@@ -111,7 +194,7 @@ AsyncEntryReader<Ts...>::AsyncEntryReader(ROOT::RDF::RNode rdf) :
         [this](ROOT::RDF::RNode rdf) {
             rdf.Filter([this](ULong64_t uEntry) {
                    const auto entry{muc::to_signed(uEntry)};
-                   if (entry == this->Last()) {
+                   while (entry == this->Last()) {
                        this->CompleteRead();
                        if (entry > this->First()) [[unlikely]] {
                            Throw<std::logic_error>(fmt::format("Current entry ({}) is larger than the specified first entry ({})", entry, this->First()));
@@ -120,20 +203,72 @@ AsyncEntryReader<Ts...>::AsyncEntryReader(ROOT::RDF::RNode rdf) :
                    if (entry < this->First()) {
                        return false;
                    }
+                   if (entry == this->First()) { // new batch
+                       fArena = std::make_shared<internal::BatchArena<Tuple<Ts...>>>(this->Last() - this->First());
+                   }
                    return true;
                },
                        {"rdfentry_"})
                 .Foreach([this]<gsl::index... Is>(gslx::index_sequence<Is...>) {
                     return [this](const typename internal::ReadHelper<Ts...>::template ReadType<Is>&... value) {
-                        this->fData.emplace_back(std::make_shared<Tuple<Ts...>>(
-                            internal::ReadHelper<Ts...>::template As<
-                                typename internal::ReadHelper<Ts...>::template TargetType<Is>>(value)...));
+                        this->fData.emplace_back(fArena, fArena->Emplace(
+                                                             internal::ReadHelper<Ts...>::template As<
+                                                                 typename internal::ReadHelper<Ts...>::template TargetType<Is>>(value)...));
+                    };
+                }(gslx::make_index_sequence<Tuple<Ts...>::Size()>{}),
+                         Tuple<Ts...>::NameVector());
+        },
+        rdf},
+    fArena{} {}
+
+template<TupleModelizable... Ts>
+AsyncEntryReader<Ts...>::~AsyncEntryReader() {
+    this->Stop(); // the read loop uses fArena
+}
+
+template<TupleModelizable... Ts>
+auto AsyncEntryReader<Ts...>::BatchBytes(gsl::index first, gsl::index last) const -> std::size_t {
+    return (last - first) * (sizeof(Tuple<Ts...>) + sizeof(std::shared_ptr<Tuple<Ts...>>));
+}
+
+template<TupleModelizable... Ts>
+AsyncBatchReader<Ts...>::AsyncBatchReader(ROOT::RDF::RNode rdf) :
+    AsyncReader<TupleBatch<Ts...>>{
+        *rdf.Count(),
+        [this](ROOT::RDF::RNode rdf) {
+            rdf.Filter([this](ULong64_t uEntry) {
+                   const auto entry{muc::to_signed(uEntry)};
+                   while (entry == this->Last()) {
+                       this->CompleteRead();
+                       if (entry > this->First()) [[unlikely]] {
+                           Throw<std::logic_error>(fmt::format("Current entry ({}) is larger than the specified first entry ({})", entry, this->First()));
+                       }
+                   }
+                   if (entry < this->First()) {
+                       return false;
+                   }
+                   return true;
+               },
+                       {"rdfentry_"})
+                .Foreach([this]<gsl::index... Is>(gslx::index_sequence<Is...>) {
+                    return [this](const typename internal::ReadHelper<Ts...>::template ReadType<Is>&... value) {
+                        this->fData.EmplaceBack(value...);
                     };
                 }(gslx::make_index_sequence<Tuple<Ts...>::Size()>{}),
                          Tuple<Ts...>::NameVector());
         },
         rdf} {}
 
+template<TupleModelizable... Ts>
+AsyncBatchReader<Ts...>::~AsyncBatchReader() {
+    this->Stop();
+}
+
+template<TupleModelizable... Ts>
+auto AsyncBatchReader<Ts...>::BatchBytes(gsl::index first, gsl::index last) const -> std::size_t {
+    return (last - first) * sizeof(Tuple<Ts...>);
+}
+
 // template<std::integral AEventIDType, muc::instantiated_from<TupleModel>... Ts>
 // AsyncEventReader<AEventIDType, Ts...>::AsyncEventReader(std::array<ROOT::RDF::RNode, sizeof...(Ts)> rdf, std::string eventIDColumnName) :
 //     AsyncEventReader{rdf, RDFEventSplit<AEventIDType>(rdf, std::move(eventIDColumnName))} {}
@@ -161,7 +296,7 @@ AsyncEventReader<AEventIDType, TupleModel<Ts...>>::AsyncEventReader(ROOT::RDF::R
             auto nextEvent{this->First()};
             rdf.Filter([&](ULong64_t uEntry) {
                    const auto entry{muc::to_signed(uEntry)};
-                   if (entry == es[this->Last()]) {
+                   while (entry == es[this->Last()]) {
                        this->CompleteRead();
                        if (entry > es[this->First()]) {
                            Throw<std::logic_error>(fmt::format("Current entry ({}) is larger than the specified first entry ({})", entry, es[this->First()]));
@@ -171,6 +306,9 @@ AsyncEventReader<AEventIDType, TupleModel<Ts...>>::AsyncEventReader(ROOT::RDF::R
                    if (entry < es[this->First()]) {
                        return false;
                    }
+                   if (entry == es[this->First()]) { // new batch
+                       fArena = std::make_shared<internal::BatchArena<Tuple<Ts...>>>(es[this->Last()] - es[this->First()]);
+                   }
                    if (entry == es[nextEvent]) {
                        this->fData.emplace_back().reserve(es[nextEvent + 1] - es[nextEvent]);
                        ++nextEvent;
@@ -180,20 +318,26 @@ AsyncEventReader<AEventIDType, TupleModel<Ts...>>::AsyncEventReader(ROOT::RDF::R
                        {"rdfentry_"})
                 .Foreach([this]<gsl::index... Is>(gslx::index_sequence<Is...>) {
                     return [this](const typename internal::ReadHelper<Ts...>::template ReadType<Is>&... value) {
-                        this->fData.back().emplace_back(std::make_shared<Tuple<Ts...>>(
-                            internal::ReadHelper<Ts...>::template As<
-                                typename internal::ReadHelper<Ts...>::template TargetType<Is>>(value)...));
+                        this->fData.back().emplace_back(fArena, fArena->Emplace(
+                                                                    internal::ReadHelper<Ts...>::template As<
+                                                                        typename internal::ReadHelper<Ts...>::template TargetType<Is>>(value)...));
                     };
                 }(gslx::make_index_sequence<Tuple<Ts...>::Size()>{}),
                          Tuple<Ts...>::NameVector());
         },
         rdf},
-    fEventSplit{std::move(eventSplit)} {
+    fEventSplit{std::move(eventSplit)},
+    fArena{} {
     Expects(not fEventSplit.empty());
     Expects(*rdf.Count() == muc::to_unsigned(fEventSplit.back()));
     Expects(std::ranges::is_sorted(fEventSplit));
 }
 
+template<std::integral AEventIDType, TupleModelizable... Ts>
+AsyncEventReader<AEventIDType, TupleModel<Ts...>>::~AsyncEventReader() {
+    this->Stop(); // the read loop uses fEventSplit and fArena
+}
+
 template<std::integral AEventIDType, TupleModelizable... Ts>
 auto AsyncEventReader<AEventIDType, TupleModel<Ts...>>::Read(gsl::index first, gsl::index last) -> void {
     const auto nEvent{ssize(fEventSplit) - 1};
@@ -206,4 +350,9 @@ auto AsyncEventReader<AEventIDType, TupleModel<Ts...>>::Read(gsl::index first, g
     AsyncReader<std::vector<muc::shared_ptrvec<Tuple<Ts...>>>>::Read(first, last);
 }
 
+template<std::integral AEventIDType, TupleModelizable... Ts>
+auto AsyncEventReader<AEventIDType, TupleModel<Ts...>>::BatchBytes(gsl::index first, gsl::index last) const -> std::size_t {
+    return (fEventSplit[last] - fEventSplit[first]) * (sizeof(Tuple<Ts...>) + sizeof(std::shared_ptr<Tuple<Ts...>>));
+}
+
 } // namespace Mustard::Data
@@ -22,6 +22,7 @@
 #include "Mustard/Data/RDFEventSplit.h++"
 #include "Mustard/Data/TakeFrom.h++"
 #include "Mustard/Data/Tuple.h++"
+#include "Mustard/Data/TupleBatch.h++"
 #include "Mustard/Data/TupleModel.h++"
 #include "Mustard/Data/internal/ProcessorBase.h++"
 #include "Mustard/Execution/Executor.h++"
@@ -42,11 +43,12 @@
 #include <algorithm>
 #include <cmath>
 #include <concepts>
+#include <deque>
 #include <functional>
-#include <future>
 #include <memory>
 #include <numeric>
 #include <ranges>
+#include <stdexcept>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -54,7 +56,8 @@
 namespace Mustard::Data {
 
 /// @brief A distributed data processor.
-/// @tparam AExecutor Underlying MPI executor type.
+/// @tparam AExecutor Underlying MPI executor type. The executor must run single-threaded,
+/// as batches are read ahead from the thread driving the scheduler.
 template<muc::instantiated_from<Executor> AExecutor = Executor<gsl::index>>
 class Processor : public internal::ProcessorBase<typename AExecutor::Index> {
 private:
@@ -67,6 +70,10 @@ public:
     template<TupleModelizable... Ts>
     auto Process(ROOT::RDF::RNode rdf,
                  std::invocable<bool, std::shared_ptr<Tuple<Ts...>>> auto&& F) -> Index;
+    /// @brief Process entries batch by batch, with the whole batch in columnar layout.
+    template<TupleModelizable... Ts>
+    auto ProcessBatch(ROOT::RDF::RNode rdf,
+                      std::invocable<bool, TupleBatch<Ts...>> auto&& F) -> Index;
 
     template<TupleModelizable... Ts, std::integral AEventIDType>
     auto Process(ROOT::RDF::RNode rdf, muc::type_tag<AEventIDType>, std::string eventIDBranchName,
@@ -82,6 +89,9 @@ private:
     template<typename AData>
     auto ProcessImpl(AsyncReader<AData>& asyncReader, Index n, std::string_view what,
                      std::invocable<bool, typename AData::value_type> auto&& F) -> Index;
+    template<typename AData>
+    auto ProcessBatchImpl(AsyncReader<AData>& asyncReader, Index n, std::string_view what,
+                          std::invocable<bool, AData> auto&& F) -> Index;
 
     static auto ByPassOccurrenceCheck(Index n, std::string_view what) -> bool;
 
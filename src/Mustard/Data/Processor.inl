@@ -39,6 +39,19 @@ auto Processor<AExecutor>::Process(ROOT::RDF::RNode rdf,
     return ProcessImpl(asyncReader, nEntry, "entries", std::forward<decltype(F)>(F));
 }
 
+template<muc::instantiated_from<Executor> AExecutor>
+template<TupleModelizable... Ts>
+auto Processor<AExecutor>::ProcessBatch(ROOT::RDF::RNode rdf,
+                                        std::invocable<bool, TupleBatch<Ts...>> auto&& F) -> Index {
+    const auto nEntry{gsl::narrow<Index>(*rdf.Count())};
+    if (nEntry == 0) {
+        return 0;
+    }
+
+    AsyncBatchReader<Ts...> asyncReader{std::move(rdf)};
+    return ProcessBatchImpl(asyncReader, nEntry, "entries", std::forward<decltype(F)>(F));
+}
+
 template<muc::instantiated_from<Executor> AExecutor>
 template<TupleModelizable... Ts, std::integral AEventIDType>
 auto Processor<AExecutor>::Process(ROOT::RDF::RNode rdf, muc::type_tag<AEventIDType>, std::string eventIDColumnName,
@@ -73,39 +86,70 @@ template<muc::instantiated_from<Executor> AExecutor>
 template<typename AData>
 auto Processor<AExecutor>::ProcessImpl(AsyncReader<AData>& asyncReader, Index n, std::string_view what,
                                        std::invocable<bool, typename AData::value_type> auto&& F) -> Index {
-    AData batchData;
-
-    Index nProcessed{};
-    const auto ProcessBatch{[&] {
+    return ProcessBatchImpl(asyncReader, n, what, [&F](bool byPass, AData batchData) {
+        if (byPass) [[unlikely]] {
+            std::invoke(std::forward<decltype(F)>(F), /*byPass =*/true, typename AData::value_type{});
+            return;
+        }
         for (auto&& data : batchData) {
             std::invoke(std::forward<decltype(F)>(F), /*byPass =*/false, std::move(data));
         }
-        nProcessed += batchData.size();
-    }};
-    std::future<void> asyncProcess;
+    });
+}
+
+template<muc::instantiated_from<Executor> AExecutor>
+template<typename AData>
+auto Processor<AExecutor>::ProcessBatchImpl(AsyncReader<AData>& asyncReader, Index n, std::string_view what,
+                                            std::invocable<bool, AData> auto&& F) -> Index {
+    // The reader and the read-ahead queue are driven both by the lookahead hook
+    // and by the tasks, so tasks must run in the thread driving the scheduler.
+    if (fExecutor.NThread() != 1) {
+        Throw<std::logic_error>(fmt::format("Processor requires a single-thread executor (got {} threads)",
+                                            fExecutor.NThread()));
+    }
 
     const auto byPassWillOccur{ByPassOccurrenceCheck(n, what)};
     const auto worldComm{mplr::comm_world()};
     const auto batch{this->CalculateBatchConfiguration(worldComm.size(), n)};
+
+    // Batches are read ahead once the executor schedules them to this process,
+    // so that reading batch k+1...k+depth overlaps processing batch k.
+    asyncReader.Depth(this->PrefetchDepth());
+    asyncReader.MemoryBudget(this->PrefetchMemoryBudget());
+    std::deque<std::pair<Index, Index>> scheduledBatch;
+    const auto ReadAhead{[&] {
+        for (; not scheduledBatch.empty() and not asyncReader.Full(); scheduledBatch.pop_front()) {
+            const auto [iFirst, iLast]{scheduledBatch.front()};
+            asyncReader.Read(iFirst, iLast);
+        }
+    }};
+    const auto lookahead{fExecutor.Lookahead()};
+    fExecutor.Lookahead(this->PrefetchDepth());
+    fExecutor.LookaheadHook([&](auto k) {
+        if (k < batch.nBatch) {
+            scheduledBatch.emplace_back(this->CalculateIndexRange(k, batch));
+            ReadAhead();
+        }
+    });
+    const auto _{gsl::finally([this, lookahead] {
+        fExecutor.LookaheadHook({});
+        fExecutor.Lookahead(lookahead);
+    })};
+
+    Index nProcessed{};
     fExecutor(std::max(static_cast<Index>(worldComm.size()), batch.nBatch), [&](auto k) { // k is batch index
         if (byPassWillOccur) [[unlikely]] {
             if (k >= n) { // by pass when there are too many processes
-                std::invoke(std::forward<decltype(F)>(F), /*byPass =*/true, typename AData::value_type{});
+                std::invoke(std::forward<decltype(F)>(F), /*byPass =*/true, AData{});
                 return;
             }
         }
-        const auto [iFirst, iLast]{this->CalculateIndexRange(k, batch)};
-        if (asyncReader.Reading()) {
-            batchData = asyncReader.Acquire();
-        }
-        asyncReader.Read(iFirst, iLast);
-        if (asyncProcess.valid()) {
-            asyncProcess.get();
-        }
-        asyncProcess = std::async(std::launch::deferred, ProcessBatch);
+        auto batchData{asyncReader.Acquire()};
+        ReadAhead();
+        const auto nData{batchData.size()};
+        std::invoke(std::forward<decltype(F)>(F), /*byPass =*/false, std::move(batchData));
+        nProcessed += nData;
     });
-    batchData = asyncReader.Acquire();
-    asyncProcess.get();
     if (not asyncReader.Exhausted()) {
         asyncReader.Exhaust();
     }
@@ -0,0 +1,61 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Data/RDFEventSplit.h++"
+#include "Mustard/IO/PrettyLog.h++"
+
+#include "TFile.h"
+#include "TUUID.h"
+
+#include "fmt/core.h"
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace Mustard::Data::internal {
+
+auto RDFEventSplitCacheKey(const RDFEventSplitCache& cache, std::string_view eventIDColumnName,
+                           std::string_view eventIDType, gsl::index nEntry) -> std::string {
+    if (cache.tree.empty() or cache.file.empty()) {
+        PrintWarning("Tree or files of the dataset not provided, event split will not be cached");
+        return {};
+    }
+    auto key{fmt::format("{} {} {} {}", eventIDType, eventIDColumnName, cache.tree, nEntry)};
+    for (auto&& fileName : cache.file) {
+        const std::unique_ptr<TFile> file{TFile::Open(fileName.c_str())};
+        if (file == nullptr or file->IsZombie()) {
+            PrintWarning(fmt::format("Cannot open {}, event split will not be cached", fileName));
+            return {};
+        }
+        key += fmt::format(" {}", file->GetUUID().AsString());
+        // size and modification time tell apart files updated in place, unavailable for remote files
+        std::error_code ec;
+        if (const auto size{std::filesystem::file_size(fileName, ec)}; not ec) {
+            key += fmt::format(":{}", size);
+        }
+        if (const auto time{std::filesystem::last_write_time(fileName, ec)}; not ec) {
+            key += fmt::format(":{}", time.time_since_epoch().count());
+        }
+    }
+    return key;
+}
+
+} // namespace Mustard::Data::internal
@@ -35,18 +35,44 @@
 #include <algorithm>
 #include <array>
 #include <concepts>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
 #include <limits>
+#include <optional>
+#include <random>
 #include <ranges>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <system_error>
 #include <utility>
 #include <vector>
 
 namespace Mustard::Data {
 
+/// @brief Cache of event splits in a directory, one file per dataset.
+///
+/// A cached split is keyed by the event ID column, the tree, the number of
+/// entries and the identity (UUID, size and modification time) of the files
+/// of the dataset. The tree and files must therefore be given, and the
+/// dataset must not be filtered. Caching is disabled if the directory is empty.
+struct RDFEventSplitCache {
+    std::filesystem::path directory;
+    std::vector<std::string> file;
+    std::string tree;
+};
+
+/// @brief Entry index of the beginning of each event, followed by the number of entries.
+///
+/// Entries of an event must be contiguous. This is an MPI collective operation:
+/// each process scans a slice of the entries, and events crossing slice
+/// boundaries are stitched. The dataframe must have a sequential event loop.
 template<std::integral T>
 auto RDFEventSplit(ROOT::RDF::RNode rdf,
-                   std::string eventIDColumnName) -> std::vector<gsl::index>;
+                   std::string eventIDColumnName,
+                   const RDFEventSplitCache& cache = {}) -> std::vector<gsl::index>;
 
 struct RDFEntryRange {
     gsl::index first;
@@ -55,11 +81,21 @@ struct RDFEntryRange {
 
 template<std::integral T, std::size_t N>
 auto RDFEventSplit(std::array<ROOT::RDF::RNode, N> rdf,
-                   const std::string& eventIDColumnName) -> std::vector<std::array<RDFEntryRange, N>>;
+                   const std::string& eventIDColumnName,
+                   const std::array<RDFEventSplitCache, N>& cache = {}) -> std::vector<std::array<RDFEntryRange, N>>;
 
 template<std::integral T, std::size_t N>
 auto RDFEventSplit(std::array<ROOT::RDF::RNode, N> rdf,
-                   const std::array<std::string, N>& eventIDColumnName) -> std::vector<std::array<RDFEntryRange, N>>;
+                   const std::array<std::string, N>& eventIDColumnName,
+                   const std::array<RDFEventSplitCache, N>& cache = {}) -> std::vector<std::array<RDFEntryRange, N>>;
+
+namespace internal {
+
+/// @brief Cache key of an event split, empty if the files of the dataset cannot be identified.
+auto RDFEventSplitCacheKey(const RDFEventSplitCache& cache, std::string_view eventIDColumnName,
+                           std::string_view eventIDType, gsl::index nEntry) -> std::string;
+
+} // namespace internal
 
 } // namespace Mustard::Data
 
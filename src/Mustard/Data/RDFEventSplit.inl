@@ -22,94 +22,249 @@ namespace internal {
 namespace {
 
 template<std::integral T>
-auto MakeFlatRDFEventSplit(ROOT::RDF::RNode rdf,
-                           std::string eventIDColumnName) -> std::pair<std::vector<T>, std::vector<gsl::index>> {
+using FlatRDFEventSplit = std::pair<std::vector<T>, std::vector<gsl::index>>;
+
+/// @brief Event IDs and beginning entries of the events in the entry range [first, last).
+template<std::integral T>
+auto ScanRDFEventSplit(ROOT::RDF::RNode rdf, std::string eventIDColumnName,
+                       gsl::index first, gsl::index last) -> FlatRDFEventSplit<T> {
+    if (first == last) { // Range(first, 0) would read to the end
+        return {};
+    }
+
     std::vector<T> eventIDList;
     std::vector<gsl::index> eventSplit;
-
-    gsl::index index{};
-    muc::flat_hash_set<T> eventIDSet;
-    rdf.Foreach(
-        [&](T eventID) {
-            if (eventIDList.empty() or eventID != eventIDList.back()) {
-                const auto [_, uniqueEventID]{eventIDSet.emplace(eventID)};
-                if (not uniqueEventID) [[unlikely]] {
-                    PrintError(fmt::format("There are more than one event {})", eventID));
+    gsl::index index{first};
+    rdf.Range(first, last)
+        .Foreach(
+            [&](T eventID) {
+                if (eventIDList.empty() or eventID != eventIDList.back()) {
+                    eventIDList.emplace_back(eventID);
+                    eventSplit.emplace_back(index);
                 }
-                eventIDList.emplace_back(eventID);
-                eventSplit.emplace_back(index);
+                ++index;
+            },
+            {std::move(eventIDColumnName)});
+
+    return {std::move(eventIDList), std::move(eventSplit)};
+}
+
+template<std::integral T>
+auto BroadcastFlatRDFEventSplit(const mplr::communicator& comm, int root, FlatRDFEventSplit<T>& flatES,
+                                mplr::irequest_pool& bcastFlatES) -> void {
+    auto& [eventID, es]{flatES};
+    auto eventIDSize{eventID.size()};
+    auto esSize{es.size()};
+    comm.bcast(root, eventIDSize);
+    comm.bcast(root, esSize);
+    eventID.resize(eventIDSize);
+    es.resize(esSize);
+    bcastFlatES.push(comm.ibcast(root, eventID.data(), mplr::vector_layout<T>{eventID.size()}));
+    bcastFlatES.push(comm.ibcast(root, es.data(), mplr::vector_layout<gsl::index>{es.size()}));
+}
+
+template<std::integral T>
+auto MakeFlatRDFEventSplit(ROOT::RDF::RNode rdf, std::string eventIDColumnName,
+                           gsl::index nEntry) -> FlatRDFEventSplit<T> {
+    const auto worldComm{mplr::available() ? mplr::comm_world() : mplr::comm_null()};
+    const auto nSlice{worldComm.is_valid() ? worldComm.size() : 1};
+    const auto thisSlice{worldComm.is_valid() ? worldComm.rank() : 0};
+
+    // each process scans a slice of entries
+    std::vector<FlatRDFEventSplit<T>> slice(nSlice);
+    slice[thisSlice] = ScanRDFEventSplit<T>(std::move(rdf), std::move(eventIDColumnName),
+                                            nEntry * thisSlice / nSlice, nEntry * (thisSlice + 1) / nSlice);
+    if (worldComm.is_valid()) {
+        mplr::irequest_pool bcastSlice;
+        for (int i{}; i < nSlice; ++i) {
+            BroadcastFlatRDFEventSplit(worldComm, i, slice[i], bcastSlice);
+        }
+        bcastSlice.waitall();
+    }
+
+    // stitch slices, an event crossing a slice boundary continues from the previous slice
+    std::vector<T> eventIDList;
+    std::vector<gsl::index> eventSplit;
+    std::size_t nEventUpperBound{};
+    for (auto&& [eventID, _] : slice) {
+        nEventUpperBound += eventID.size();
+    }
+    eventIDList.reserve(nEventUpperBound);
+    eventSplit.reserve(nEventUpperBound + 1);
+    for (auto&& [eventID, es] : slice) {
+        const auto continued{not eventID.empty() and not eventIDList.empty() and eventID.front() == eventIDList.back()};
+        eventIDList.insert(eventIDList.end(), eventID.cbegin() + continued, eventID.cend());
+        eventSplit.insert(eventSplit.end(), es.cbegin() + continued, es.cend());
+        eventID = {};
+        es = {};
+    }
+    eventSplit.emplace_back(nEntry);
+
+    if (not worldComm.is_valid() or worldComm.rank() == 0) {
+        muc::flat_hash_set<T> eventIDSet;
+        eventIDSet.reserve(eventIDList.size());
+        for (auto&& eventID : eventIDList) {
+            const auto [_, uniqueEventID]{eventIDSet.emplace(eventID)};
+            if (not uniqueEventID) [[unlikely]] {
+                PrintError(fmt::format("There are more than one event {})", eventID));
             }
-            ++index;
-        },
-        {std::move(eventIDColumnName)});
-    eventSplit.emplace_back(index);
+        }
+    }
 
     return {std::move(eventIDList), std::move(eventSplit)};
 }
 
+auto RDFEventSplitCachePath(const RDFEventSplitCache& cache, std::string_view key) -> std::filesystem::path {
+    return cache.directory / fmt::format("{:016x}.es", std::hash<std::string_view>{}(key));
+}
+
+constexpr std::string_view gRDFEventSplitCacheMagic{"MustardRDFEventSplit1"};
+
+template<std::integral T>
+auto ReadRDFEventSplitCache(const std::filesystem::path& path, std::string_view key,
+                            gsl::index nEntry) -> std::optional<FlatRDFEventSplit<T>> {
+    std::ifstream is{path, std::ios::binary};
+    if (not is.is_open()) {
+        return std::nullopt;
+    }
+    const auto Read{[&is](void* data, std::size_t size) { is.read(static_cast<char*>(data), size); }};
+    std::string magic(gRDFEventSplitCacheMagic.size(), '\0');
+    Read(magic.data(), magic.size());
+    std::uint64_t keySize{};
+    Read(&keySize, sizeof(keySize));
+    if (not is or magic != gRDFEventSplitCacheMagic or keySize != key.size()) {
+        return std::nullopt;
+    }
+    std::string cachedKey(keySize, '\0');
+    Read(cachedKey.data(), cachedKey.size());
+    if (cachedKey != key) { // hash collision
+        return std::nullopt;
+    }
+    std::uint64_t nEvent{};
+    Read(&nEvent, sizeof(nEvent));
+    const auto position{is.tellg()};
+    is.seekg(0, std::ios::end);
+    if (not is or static_cast<std::uint64_t>(is.tellg() - position) != nEvent * sizeof(T) + (nEvent + 1) * sizeof(gsl::index)) {
+        PrintWarning(fmt::format("Event split cache {} is corrupted, ignored", path.generic_string()));
+        return std::nullopt;
+    }
+    is.seekg(position);
+    FlatRDFEventSplit<T> flatES;
+    auto& [eventID, es]{flatES};
+    eventID.resize(nEvent);
+    es.resize(nEvent + 1);
+    Read(eventID.data(), eventID.size() * sizeof(T));
+    Read(es.data(), es.size() * sizeof(gsl::index));
+    if (not is) {
+        PrintWarning(fmt::format("Event split cache {} is corrupted, ignored", path.generic_string()));
+        return std::nullopt;
+    }
+    if (es.back() != nEntry) {
+        PrintWarning(fmt::format("Event split cache {} has {} entries but the dataset has {}, ignored",
+                                 path.generic_string(), es.back(), nEntry));
+        return std::nullopt;
+    }
+    return flatES;
+}
+
+template<std::integral T>
+auto WriteRDFEventSplitCache(const std::filesystem::path& path, std::string_view key, const FlatRDFEventSplit<T>& flatES) -> void {
+    const auto& [eventID, es]{flatES};
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+    // written aside and renamed, so that readers never see a partial cache
+    auto temporary{path};
+    temporary += fmt::format(".{:08x}.tmp", std::random_device{}());
+    {
+        std::ofstream os{temporary, std::ios::binary};
+        const auto Write{[&os](const void* data, std::size_t size) { os.write(static_cast<const char*>(data), size); }};
+        const std::uint64_t keySize{key.size()};
+        const std::uint64_t nEvent{eventID.size()};
+        Write(gRDFEventSplitCacheMagic.data(), gRDFEventSplitCacheMagic.size());
+        Write(&keySize, sizeof(keySize));
+        Write(key.data(), key.size());
+        Write(&nEvent, sizeof(nEvent));
+        Write(eventID.data(), eventID.size() * sizeof(T));
+        Write(es.data(), es.size() * sizeof(gsl::index));
+        if (not os.flush()) {
+            ec = std::make_error_code(std::errc::io_error);
+        }
+    }
+    if (not ec) {
+        std::filesystem::rename(temporary, path, ec);
+    }
+    if (ec) {
+        PrintWarning(fmt::format("Cannot write event split cache {} ({})", path.generic_string(), ec.message()));
+        std::filesystem::remove(temporary, ec);
+    }
+}
+
+template<std::integral T>
+auto CachedFlatRDFEventSplit(ROOT::RDF::RNode rdf, std::string eventIDColumnName,
+                             const RDFEventSplitCache& cache) -> FlatRDFEventSplit<T> {
+    const auto nEntry{gsl::narrow<gsl::index>(*rdf.Count())};
+    if (cache.directory.empty()) {
+        return MakeFlatRDFEventSplit<T>(std::move(rdf), std::move(eventIDColumnName), nEntry);
+    }
+    // the master looks up and writes the cache
+    const auto worldComm{mplr::available() ? mplr::comm_world() : mplr::comm_null()};
+    const auto master{not worldComm.is_valid() or worldComm.rank() == 0};
+    std::string key;
+    std::optional<FlatRDFEventSplit<T>> flatES;
+    if (master) {
+        key = RDFEventSplitCacheKey(cache, eventIDColumnName,
+                                    fmt::format("{}{}", std::signed_integral<T> ? "int" : "uint", 8 * sizeof(T)), nEntry);
+        if (not key.empty()) {
+            flatES = ReadRDFEventSplitCache<T>(RDFEventSplitCachePath(cache, key), key, nEntry);
+        }
+    }
+    auto cached{flatES.has_value()};
+    if (worldComm.is_valid()) {
+        worldComm.bcast(0, cached);
+    }
+    if (cached) {
+        if (worldComm.is_valid()) {
+            mplr::irequest_pool bcastFlatES;
+            BroadcastFlatRDFEventSplit(worldComm, 0, flatES ? *flatES : flatES.emplace(), bcastFlatES);
+            bcastFlatES.waitall();
+        }
+        return std::move(*flatES);
+    }
+    auto result{MakeFlatRDFEventSplit<T>(std::move(rdf), std::move(eventIDColumnName), nEntry)};
+    if (master and not key.empty()) {
+        WriteRDFEventSplitCache(RDFEventSplitCachePath(cache, key), key, result);
+    }
+    return result;
+}
+
 } // namespace
 } // namespace internal
 
 template<std::integral T>
 auto RDFEventSplit(ROOT::RDF::RNode rdf,
-                   std::string eventIDColumnName) -> std::vector<gsl::index> {
-    const auto MakeFlatRDFEventSplit{[&] {
-        return internal::MakeFlatRDFEventSplit<T>(std::move(rdf), std::move(eventIDColumnName)).second;
-    }};
-    if (mplr::available()) {
-        const auto worldComm{mplr::comm_world()};
-        auto eventSplit{worldComm.rank() == 0 ? MakeFlatRDFEventSplit() : std::vector<gsl::index>{}};
-        auto eventSplitSize{eventSplit.size()};
-        worldComm.bcast(0, eventSplitSize);
-        eventSplit.resize(eventSplitSize);
-        worldComm.bcast(0, eventSplit.data(), mplr::vector_layout<gsl::index>{eventSplit.size()});
-        return eventSplit;
-    } else {
-        return MakeFlatRDFEventSplit();
-    }
+                   std::string eventIDColumnName,
+                   const RDFEventSplitCache& cache) -> std::vector<gsl::index> {
+    return internal::CachedFlatRDFEventSplit<T>(std::move(rdf), std::move(eventIDColumnName), cache).second;
 }
 
 template<std::integral T, std::size_t N>
 auto RDFEventSplit(std::array<ROOT::RDF::RNode, N> rdf,
-                   const std::string& eventIDColumnName) -> std::vector<std::array<RDFEntryRange, N>> {
+                   const std::string& eventIDColumnName,
+                   const std::array<RDFEventSplitCache, N>& cache) -> std::vector<std::array<RDFEntryRange, N>> {
     std::array<std::string, N> columnName;
     columnName.fill(eventIDColumnName);
-    return RDFEventSplit<T>(rdf, columnName);
+    return RDFEventSplit<T>(rdf, columnName, cache);
 }
 
 template<std::integral T, std::size_t N>
 auto RDFEventSplit(std::array<ROOT::RDF::RNode, N> rdf,
-                   const std::array<std::string, N>& eventIDColumnName) -> std::vector<std::array<RDFEntryRange, N>> {
+                   const std::array<std::string, N>& eventIDColumnName,
+                   const std::array<RDFEventSplitCache, N>& cache) -> std::vector<std::array<RDFEntryRange, N>> {
     constexpr auto nRDF{static_cast<gsl::index>(N)};
-    std::array<std::pair<std::vector<T>, std::vector<gsl::index>>, N> flatES;
-    // Build all RDF event split
-    const auto MakeFlatRDFEventSplit{[&](gsl::index i) {
-        return internal::MakeFlatRDFEventSplit<T>(std::move(rdf[i]), eventIDColumnName[i]);
-    }};
-    if (mplr::available()) {
-        const auto worldComm{mplr::comm_world()};
-        for (gsl::index i{}; i < nRDF; ++i) {
-            if (worldComm.rank() == i % worldComm.size()) {
-                flatES[i] = MakeFlatRDFEventSplit(i);
-            }
-        }
-        // Broadcast to all processes
-        mplr::irequest_pool bcastFlatES;
-        for (gsl::index i{}; i < nRDF; ++i) {
-            auto& [eventID, es]{flatES[i]};
-            const auto rootRank{i % worldComm.size()};
-            auto esSize{es.size()};
-            worldComm.bcast(rootRank, esSize);
-            eventID.resize(esSize - 1);
-            es.resize(esSize);
-            bcastFlatES.push(worldComm.ibcast(rootRank, eventID.data(), mplr::vector_layout<T>{eventID.size()}));
-            bcastFlatES.push(worldComm.ibcast(rootRank, es.data(), mplr::vector_layout<gsl::index>{es.size()}));
-        }
-        bcastFlatES.waitall();
-    } else {
-        for (gsl::index i{}; i < nRDF; ++i) {
-            flatES[i] = MakeFlatRDFEventSplit(i);
-        }
+    std::array<internal::FlatRDFEventSplit<T>, N> flatES;
+    // Build all RDF event split, all processes take part in each
+    for (gsl::index i{}; i < nRDF; ++i) {
+        flatES[i] = internal::CachedFlatRDFEventSplit<T>(std::move(rdf[i]), eventIDColumnName[i], cache[i]);
     }
 
     std::array<muc::flat_hash_map<T, RDFEntryRange>, N> eventMap;
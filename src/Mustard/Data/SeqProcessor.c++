@@ -37,6 +37,12 @@ auto SeqProcessor::IterationEndAction() -> void {
     }
 }
 
+auto SeqProcessor::BatchEndAction(Index nProcessed) -> void {
+    if (fPrintProgress) {
+        fProgressBar.Update(nProcessed);
+    }
+}
+
 auto SeqProcessor::LoopEndAction() -> void {
     if (fPrintProgress) {
         fProgressBar.Complete();
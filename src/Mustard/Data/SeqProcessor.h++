@@ -22,6 +22,7 @@
 #include "Mustard/Data/RDFEventSplit.h++"
 #include "Mustard/Data/TakeFrom.h++"
 #include "Mustard/Data/Tuple.h++"
+#include "Mustard/Data/TupleBatch.h++"
 #include "Mustard/Data/TupleModel.h++"
 #include "Mustard/Data/internal/ProcessorBase.h++"
 #include "Mustard/IO/PrettyLog.h++"
@@ -66,6 +67,10 @@ public:
     template<TupleModelizable... Ts>
     auto Process(ROOT::RDF::RNode rdf,
                  std::invocable<std::shared_ptr<Tuple<Ts...>>> auto&& F) -> Index;
+    /// @brief Process entries batch by batch, with the whole batch in columnar layout.
+    template<TupleModelizable... Ts>
+    auto ProcessBatch(ROOT::RDF::RNode rdf,
+                      std::invocable<TupleBatch<Ts...>> auto&& F) -> Index;
 
     template<TupleModelizable... Ts, std::integral AEventIDType>
     auto Process(ROOT::RDF::RNode rdf, muc::type_tag<AEventIDType>, std::string eventIDBranchName,
@@ -91,10 +96,14 @@ private:
     template<typename AData>
     auto ProcessImpl(AsyncReader<AData>& asyncReader, Index n,
                      std::invocable<typename AData::value_type> auto&& F) -> Index;
+    template<typename AData>
+    auto ProcessBatchImpl(AsyncReader<AData>& asyncReader, Index n,
+                          std::invocable<AData> auto&& F) -> Index;
 
 private:
     auto LoopBeginAction(Index nTotal) -> void;
     auto IterationEndAction() -> void;
+    auto BatchEndAction(Index nProcessed) -> void;
     auto LoopEndAction() -> void;
 
 private:
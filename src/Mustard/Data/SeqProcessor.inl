@@ -30,6 +30,18 @@ auto SeqProcessor::Process(ROOT::RDF::RNode rdf,
     return ProcessImpl(asyncReader, nEntry, std::forward<decltype(F)>(F));
 }
 
+template<TupleModelizable... Ts>
+auto SeqProcessor::ProcessBatch(ROOT::RDF::RNode rdf,
+                                std::invocable<TupleBatch<Ts...>> auto&& F) -> Index {
+    const auto nEntry{gsl::narrow<Index>(*rdf.Count())};
+    if (nEntry == 0) {
+        return 0;
+    }
+
+    AsyncBatchReader<Ts...> asyncReader{std::move(rdf)};
+    return ProcessBatchImpl(asyncReader, nEntry, std::forward<decltype(F)>(F));
+}
+
 template<TupleModelizable... Ts, std::integral AEventIDType>
 auto SeqProcessor::Process(ROOT::RDF::RNode rdf, muc::type_tag<AEventIDType>, std::string eventIDColumnName,
                            std::invocable<muc::shared_ptrvec<Tuple<Ts...>>> auto&& F) -> Index {
@@ -102,7 +114,7 @@ auto SeqProcessor::Process(std::array<ROOT::RDF::RNode, sizeof...(Ts)> rdf,
     }
 
     Index nEventProcessed{};
-    const auto ProcessBatch{[&](Index iFirst, Index iLast, std::tuple<muc::shared_ptrvec<Tuple<Ts>>...> data) {
+    const auto ProcessEventBatch{[&](Index iFirst, Index iLast, std::tuple<muc::shared_ptrvec<Tuple<Ts>>...> data) {
         for (auto i{iFirst}; i < iLast; ++i) {
             std::tuple<muc::shared_ptrvec<Tuple<Ts>>...> event;
             [&]<gsl::index... Is>(gslx::index_sequence<Is...>) {
@@ -153,7 +165,7 @@ auto SeqProcessor::Process(std::array<ROOT::RDF::RNode, sizeof...(Ts)> rdf,
         if (async.valid()) {
             async.get();
         }
-        async = std::async(ProcessBatch, iFirst, iLast, std::move(data));
+        async = std::async(ProcessEventBatch, iFirst, iLast, std::move(data));
     }
     async.get();
     LoopEndAction();
@@ -163,33 +175,41 @@ auto SeqProcessor::Process(std::array<ROOT::RDF::RNode, sizeof...(Ts)> rdf,
 template<typename AData>
 auto SeqProcessor::ProcessImpl(AsyncReader<AData>& asyncReader, Index n,
                                std::invocable<typename AData::value_type> auto&& F) -> Index {
-    AData batchData;
-
-    Index nProcessed{};
-    const auto ProcessBatch{[&] {
+    return ProcessBatchImpl(asyncReader, n, [&F, this](AData batchData) {
         for (auto&& data : batchData) {
             std::invoke(std::forward<decltype(F)>(F), std::move(data));
-            ++nProcessed;
             IterationEndAction();
         }
-    }};
-    std::future<void> asyncProcess;
+    });
+}
 
+template<typename AData>
+auto SeqProcessor::ProcessBatchImpl(AsyncReader<AData>& asyncReader, Index n,
+                                    std::invocable<AData> auto&& F) -> Index {
     const auto batch{CalculateBatchConfiguration(1, n)};
+
+    // reading batch k+1...k+depth overlaps processing batch k
+    asyncReader.Depth(PrefetchDepth());
+    asyncReader.MemoryBudget(PrefetchMemoryBudget());
+    Index kRead{};
+    const auto ReadAhead{[&] {
+        for (; kRead < batch.nBatch and not asyncReader.Full(); ++kRead) {
+            const auto [iFirst, iLast]{CalculateIndexRange(kRead, batch)};
+            asyncReader.Read(iFirst, iLast);
+        }
+    }};
+
+    Index nProcessed{};
     LoopBeginAction(n);
+    ReadAhead();
     for (Index k{}; k < batch.nBatch; ++k) { // k is batch index
-        const auto [iFirst, iLast]{CalculateIndexRange(k, batch)};
-        if (asyncReader.Reading()) {
-            batchData = asyncReader.Acquire();
-        }
-        asyncReader.Read(iFirst, iLast);
-        if (asyncProcess.valid()) {
-            asyncProcess.get();
-        }
-        asyncProcess = std::async(std::launch::deferred, ProcessBatch);
+        auto batchData{asyncReader.Acquire()};
+        ReadAhead();
+        const auto nData{batchData.size()};
+        std::invoke(std::forward<decltype(F)>(F), std::move(batchData));
+        nProcessed += nData;
+        BatchEndAction(nProcessed);
     }
-    batchData = asyncReader.Acquire();
-    asyncProcess.get();
     LoopEndAction();
 
     return nProcessed;
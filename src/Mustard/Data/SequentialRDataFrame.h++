@@ -0,0 +1,44 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "ROOT/RDataFrame.hxx"
+#include "TROOT.h"
+#include "TTreeCacheUnzip.h"
+
+#include "gsl/gsl"
+
+#include <utility>
+
+namespace Mustard::Data {
+
+/// @brief Constructs a RDataFrame with a sequential event loop, even if ROOT
+/// implicit multithreading (IMT) is enabled.
+///
+/// Entries are then visited in order, as required by the async readers of
+/// Processor and SeqProcessor, while IMT stays enabled and TTree baskets are
+/// decompressed in parallel on the IMT thread pool (TTreeCacheUnzip).
+/// IMT is disabled during construction, so no other IMT work may run meanwhile.
+/// @param args Arguments forwarded to the RDataFrame constructor.
+template<typename... Args>
+auto SequentialRDataFrame(Args&&... args) -> ROOT::RDataFrame;
+
+} // namespace Mustard::Data
+
+#include "Mustard/Data/SequentialRDataFrame.inl"
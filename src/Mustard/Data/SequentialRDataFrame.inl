@@ -0,0 +1,33 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Data {
+
+template<typename... Args>
+auto SequentialRDataFrame(Args&&... args) -> ROOT::RDataFrame {
+    if (not ROOT::IsImplicitMTEnabled()) {
+        return ROOT::RDataFrame{std::forward<Args>(args)...};
+    }
+    TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::kEnable);
+    const auto nThread{ROOT::GetThreadPoolSize()};
+    ROOT::DisableImplicitMT();
+    const auto _{gsl::finally([nThread] { ROOT::EnableImplicitMT(nThread); })};
+    return ROOT::RDataFrame{std::forward<Args>(args)...};
+}
+
+} // namespace Mustard::Data
@@ -19,6 +19,8 @@
 #pragma once
 
 #include "Mustard/Data/Tuple.h++"
+#include "Mustard/Data/TupleBatch.h++"
+#include "Mustard/Data/internal/BatchArena.h++"
 #include "Mustard/Data/internal/ReadHelper.h++"
 #include "Mustard/Utility/NonConstructibleBase.h++"
 #include "Mustard/gslx/index_sequence.h++"
@@ -37,6 +39,7 @@ template<TupleModelizable... Ts>
 class Take : public NonConstructibleBase {
 public:
     static auto From(ROOT::RDF::RNode rdf) -> muc::shared_ptrvec<Tuple<Ts...>>;
+    static auto BatchFrom(ROOT::RDF::RNode rdf) -> TupleBatch<Ts...>;
 
 private:
     template<gsl::index... Is>
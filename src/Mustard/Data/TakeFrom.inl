@@ -27,21 +27,35 @@ auto Take<Ts...>::From(ROOT::RDF::RNode rdf) -> muc::shared_ptrvec<Tuple<Ts...>>
     return data;
 }
 
+template<TupleModelizable... Ts>
+auto Take<Ts...>::BatchFrom(ROOT::RDF::RNode rdf) -> TupleBatch<Ts...> {
+    TupleBatch<Ts...> data;
+    rdf.Foreach([&data]<gsl::index... Is>(gslx::index_sequence<Is...>) {
+        return [&data](const typename internal::ReadHelper<Ts...>::template ReadType<Is>&... value) {
+            data.EmplaceBack(value...);
+        };
+    }(gslx::make_index_sequence<Tuple<Ts...>::Size()>{}),
+                Tuple<Ts...>::NameVector());
+    return data;
+}
+
 template<TupleModelizable... Ts>
 template<gsl::index... Is>
 class Take<Ts...>::TakeOne {
 public:
     TakeOne(muc::shared_ptrvec<Tuple<Ts...>>& data, gslx::index_sequence<Is...>) :
-        fData{data} {}
+        fData{data},
+        fArena{std::make_shared<internal::BatchArena<Tuple<Ts...>>>()} {}
 
     auto operator()(const typename internal::ReadHelper<Ts...>::template ReadType<Is>&... value) -> void {
-        fData.emplace_back(std::make_shared<Tuple<Ts...>>(
-            internal::ReadHelper<Ts...>::template As<
-                typename internal::ReadHelper<Ts...>::template TargetType<Is>>(value)...));
+        fData.emplace_back(fArena, fArena->Emplace(
+                                       internal::ReadHelper<Ts...>::template As<
+                                           typename internal::ReadHelper<Ts...>::template TargetType<Is>>(value)...));
     }
 
 private:
     muc::shared_ptrvec<Tuple<Ts...>>& fData;
+    std::shared_ptr<internal::BatchArena<Tuple<Ts...>>> fArena;
 };
 
 } // namespace Mustard::Data
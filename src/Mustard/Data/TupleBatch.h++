@@ -0,0 +1,112 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Data/Tuple.h++"
+#include "Mustard/Data/TupleModel.h++"
+#include "Mustard/Data/internal/TupleBatchColumn.h++"
+#include "Mustard/gslx/index_sequence.h++"
+
+#include "muc/ceta_string"
+#include "muc/utility"
+
+#include "gsl/gsl"
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Mustard::Data {
+
+/// @brief Columnar (structure-of-arrays) batch of data model defined tuples.
+///
+/// Each `Value` of the model is one contiguous column (see `Column`). A
+/// `std::vector` value is stored in an offsets + values (jagged) column, so
+/// appending an entry does not allocate per entry. Entries are accessed by
+/// lightweight row proxies (`operator[]`, iteration), which support `Get` like
+/// `Tuple`: a non-vector value gives a reference to the stored `Value`, a
+/// vector value gives a subrange of the jagged column.
+///
+/// @note `Size()` is the number of values of the model (as `Tuple::Size()`),
+/// `size()` is the number of entries.
+template<TupleModelizable... Ts>
+class TupleBatch {
+public:
+    using Model = TupleModel<Ts...>;
+
+private:
+    template<bool AConst>
+    class BasicRow;
+    template<bool AConst>
+    class BasicIterator;
+
+public:
+    using Row = BasicRow<false>;
+    using ConstRow = BasicRow<true>;
+    using value_type = Row;
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+
+public:
+    TupleBatch() = default;
+
+    template<muc::ceta_string AName>
+    auto Column() const -> const auto& { return std::get<Model::template Index<AName>()>(fColumn); }
+    template<muc::ceta_string AName>
+    auto Column() -> auto& { return std::get<Model::template Index<AName>()>(fColumn); }
+
+    auto operator[](gsl::index i) const -> ConstRow { return {*this, i}; }
+    auto operator[](gsl::index i) -> Row { return {*this, i}; }
+
+    auto begin() const -> const_iterator { return {*this, 0}; }
+    auto begin() -> iterator { return {*this, 0}; }
+    auto end() const -> const_iterator { return {*this, muc::to_signed(size())}; }
+    auto end() -> iterator { return {*this, muc::to_signed(size())}; }
+
+    auto size() const -> std::size_t;
+    auto empty() const -> bool { return size() == 0; }
+    auto reserve(std::size_t n) -> void;
+    auto clear() -> void;
+
+    template<typename... Us>
+        requires(sizeof...(Us) == TupleModel<Ts...>::Size())
+    auto EmplaceBack(Us&&... value) -> void;
+    auto PushBack(const Tuple<Ts...>& tuple) -> void;
+
+    static constexpr auto Size() -> auto { return Model::Size(); }
+    static auto NameVector() -> auto { return Model::NameVector(); }
+
+private:
+    template<typename>
+    struct ColumnTupleHelper;
+    template<typename... AValues>
+    struct ColumnTupleHelper<std::tuple<AValues...>> {
+        using Type = std::tuple<internal::TupleBatchColumn<AValues>...>;
+    };
+
+private:
+    typename ColumnTupleHelper<typename Model::StdTuple>::Type fColumn;
+};
+
+} // namespace Mustard::Data
+
+#include "Mustard/Data/TupleBatch.inl"
@@ -0,0 +1,166 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Data {
+
+template<TupleModelizable... Ts>
+template<bool AConst>
+class TupleBatch<Ts...>::BasicRow : public internal::EnableGet<BasicRow<AConst>> {
+public:
+    using Model = TupleModel<Ts...>;
+
+private:
+    using Batch = std::conditional_t<AConst, const TupleBatch, TupleBatch>;
+
+public:
+    BasicRow(Batch& batch, gsl::index i) :
+        internal::EnableGet<BasicRow>{},
+        fBatch{&batch},
+        fIndex{i} {}
+
+    operator BasicRow<true>() const
+        requires(not AConst)
+    { return {*fBatch, fIndex}; }
+
+    template<muc::ceta_string AName>
+    auto Get() const -> decltype(auto) { return fBatch->template Column<AName>()[fIndex]; }
+    template<muc::ceta_string... ANames>
+        requires(sizeof...(ANames) >= 2)
+    auto Get() const -> auto { return Tuple<typename Model::template ValueOf<ANames>...>{fBatch->template Column<ANames>().Copy(fIndex)...}; }
+
+    /// @brief Copy the entry to a tuple.
+    template<SubTuple<Tuple<Ts...>> ATuple = Tuple<Ts...>>
+    auto As() const -> ATuple;
+
+    auto Index() const -> auto { return fIndex; }
+
+    static constexpr auto Size() -> auto { return Model::Size(); }
+    static auto NameVector() -> auto { return Model::NameVector(); }
+
+private:
+    Batch* fBatch;
+    gsl::index fIndex;
+};
+
+template<TupleModelizable... Ts>
+template<bool AConst>
+class TupleBatch<Ts...>::BasicIterator {
+public:
+    using iterator_concept = std::random_access_iterator_tag;
+    using value_type = BasicRow<AConst>;
+    using difference_type = gsl::index;
+
+private:
+    using Batch = std::conditional_t<AConst, const TupleBatch, TupleBatch>;
+
+public:
+    BasicIterator() :
+        fBatch{},
+        fIndex{} {}
+    BasicIterator(Batch& batch, gsl::index i) :
+        fBatch{&batch},
+        fIndex{i} {}
+
+    auto operator*() const -> value_type { return {*fBatch, fIndex}; }
+    auto operator[](difference_type n) const -> value_type { return {*fBatch, fIndex + n}; }
+
+    auto operator++() -> auto& {
+        ++fIndex;
+        return *this;
+    }
+    auto operator--() -> auto& {
+        --fIndex;
+        return *this;
+    }
+    auto operator++(int) -> auto {
+        const auto old{*this};
+        ++fIndex;
+        return old;
+    }
+    auto operator--(int) -> auto {
+        const auto old{*this};
+        --fIndex;
+        return old;
+    }
+    auto operator+=(difference_type n) -> auto& {
+        fIndex += n;
+        return *this;
+    }
+    auto operator-=(difference_type n) -> auto& {
+        fIndex -= n;
+        return *this;
+    }
+
+    friend auto operator+(BasicIterator i, difference_type n) -> BasicIterator { return i += n; }
+    friend auto operator+(difference_type n, BasicIterator i) -> BasicIterator { return i += n; }
+    friend auto operator-(BasicIterator i, difference_type n) -> BasicIterator { return i -= n; }
+    friend auto operator-(const BasicIterator& i, const BasicIterator& j) -> difference_type { return i.fIndex - j.fIndex; }
+
+    auto operator==(const BasicIterator& that) const -> bool { return fIndex == that.fIndex; }
+    auto operator<=>(const BasicIterator& that) const -> auto { return fIndex <=> that.fIndex; }
+
+private:
+    Batch* fBatch;
+    gsl::index fIndex;
+};
+
+template<TupleModelizable... Ts>
+template<bool AConst>
+template<SubTuple<Tuple<Ts...>> ATuple>
+auto TupleBatch<Ts...>::BasicRow<AConst>::As() const -> ATuple {
+    return [this]<gsl::index... Is>(gslx::index_sequence<Is...>) {
+        return ATuple{fBatch->template Column<std::tuple_element_t<Is, ATuple>::Name()>().Copy(fIndex)...};
+    }(gslx::make_index_sequence<ATuple::Size()>{});
+}
+
+template<TupleModelizable... Ts>
+auto TupleBatch<Ts...>::size() const -> std::size_t {
+    if constexpr (Size() == 0) {
+        return 0;
+    } else {
+        return muc::to_unsigned(std::get<0>(fColumn).Size());
+    }
+}
+
+template<TupleModelizable... Ts>
+auto TupleBatch<Ts...>::reserve(std::size_t n) -> void {
+    std::apply([n = muc::to_signed(n)](auto&... column) { (..., column.Reserve(n)); }, fColumn);
+}
+
+template<TupleModelizable... Ts>
+auto TupleBatch<Ts...>::clear() -> void {
+    std::apply([](auto&... column) { (..., column.Clear()); }, fColumn);
+}
+
+template<TupleModelizable... Ts>
+template<typename... Us>
+    requires(sizeof...(Us) == TupleModel<Ts...>::Size())
+auto TupleBatch<Ts...>::EmplaceBack(Us&&... value) -> void {
+    [&]<gsl::index... Is>(gslx::index_sequence<Is...>) {
+        (..., std::get<Is>(fColumn).Append(std::forward<Us>(value)));
+    }(gslx::make_index_sequence<Size()>{});
+}
+
+template<TupleModelizable... Ts>
+auto TupleBatch<Ts...>::PushBack(const Tuple<Ts...>& tuple) -> void {
+    [&]<gsl::index... Is>(gslx::index_sequence<Is...>) {
+        EmplaceBack(*tuple.template Get<std::tuple_element_t<Is, typename Model::StdTuple>::Name()>()...);
+    }(gslx::make_index_sequence<Size()>{});
+}
+
+} // namespace Mustard::Data
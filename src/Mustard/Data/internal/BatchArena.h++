@@ -0,0 +1,60 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Utility/NonCopyableBase.h++"
+
+#include "gsl/gsl"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace Mustard::Data::internal {
+
+/// @brief Monotonic arena holding one batch of objects.
+///
+/// Objects are constructed one after another in a few large blocks of a
+/// `std::pmr::monotonic_buffer_resource`, sized for the expected number of
+/// objects. Users hand out aliasing `std::shared_ptr`s sharing ownership of
+/// the arena (`std::shared_ptr<T>{arena, arena->Emplace(...)}`), so the whole
+/// batch is destroyed and released at once when the last reference drops.
+template<typename T>
+class BatchArena : public NonCopyableBase {
+public:
+    explicit BatchArena(gsl::index nReserve = 0);
+    ~BatchArena();
+
+    template<typename... Args>
+    auto Emplace(Args&&... args) -> T*;
+
+    auto Size() const -> gsl::index { return ssize(fObject); }
+
+private:
+    std::pmr::monotonic_buffer_resource fResource;
+    std::pmr::vector<T*> fObject;
+};
+
+} // namespace Mustard::Data::internal
+
+#include "Mustard/Data/internal/BatchArena.inl"
@@ -0,0 +1,50 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Data::internal {
+
+template<typename T>
+BatchArena<T>::BatchArena(gsl::index nReserve) :
+    NonCopyableBase{},
+    fResource{std::max<std::size_t>(nReserve, 1) * (sizeof(T) + sizeof(T*))},
+    fObject{&fResource} {
+    fObject.reserve(nReserve);
+}
+
+template<typename T>
+BatchArena<T>::~BatchArena() {
+    for (auto&& object : std::views::reverse(fObject)) {
+        std::destroy_at(object);
+    }
+}
+
+template<typename T>
+template<typename... Args>
+auto BatchArena<T>::Emplace(Args&&... args) -> T* {
+    const auto object{std::construct_at(static_cast<T*>(fResource.allocate(sizeof(T), alignof(T))),
+                                        std::forward<Args>(args)...)};
+    try {
+        fObject.emplace_back(object);
+    } catch (...) {
+        std::destroy_at(object);
+        throw;
+    }
+    return object;
+}
+
+} // namespace Mustard::Data::internal
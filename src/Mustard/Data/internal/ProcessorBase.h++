@@ -25,6 +25,7 @@
 #include <algorithm>
 #include <cmath>
 #include <concepts>
+#include <cstddef>
 #include <utility>
 
 namespace Mustard::Data::internal {
@@ -39,8 +40,14 @@ protected:
     ~ProcessorBase() = default;
 
 public:
-    auto BatchSizeProposal(T val) -> void { fBatchSizeProposal = std::max(1, val); }
+    auto BatchSizeProposal(T val) -> void { fBatchSizeProposal = std::max(T{1}, val); }
     auto BatchSizeProposal() const -> auto { return fBatchSizeProposal; }
+    /// @brief Number of batches read ahead of the one being processed.
+    auto PrefetchDepth(int n) -> void { fPrefetchDepth = std::max(1, n); }
+    auto PrefetchDepth() const -> auto { return fPrefetchDepth; }
+    /// @brief No more batches are read ahead once the estimated memory of those being read reaches the budget.
+    auto PrefetchMemoryBudget(std::size_t bytes) -> void { fPrefetchMemoryBudget = bytes; }
+    auto PrefetchMemoryBudget() const -> auto { return fPrefetchMemoryBudget; }
 
 protected:
     struct BatchConfiguration {
@@ -54,6 +61,8 @@ protected:
 
 private:
     T fBatchSizeProposal;
+    int fPrefetchDepth;
+    std::size_t fPrefetchMemoryBudget;
 };
 
 } // namespace Mustard::Data::internal
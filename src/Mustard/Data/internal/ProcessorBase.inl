@@ -20,7 +20,9 @@ namespace Mustard::Data::internal {
 
 template<std::integral T>
 ProcessorBase<T>::ProcessorBase() :
-    fBatchSizeProposal{300000} {}
+    fBatchSizeProposal{300000},
+    fPrefetchDepth{2},
+    fPrefetchMemoryBudget{std::size_t{1} << 30} {}
 
 template<std::integral T>
 auto ProcessorBase<T>::CalculateBatchConfiguration(T nProcess, T nTotal) const -> BatchConfiguration {
@@ -0,0 +1,104 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Data/internal/TypeTraits.h++"
+
+#include "muc/concepts"
+
+#include "gsl/gsl"
+
+#include <algorithm>
+#include <concepts>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Mustard::Data::internal {
+
+/// @brief One column of a `TupleBatch`: the values of all entries, stored contiguously.
+/// @tparam AValue The `Value` type of the column.
+template<typename AValue>
+class TupleBatchColumn {
+public:
+    using ValueType = AValue;
+
+public:
+    TupleBatchColumn();
+
+    auto Size() const -> gsl::index { return ssize(fValue); }
+    auto Reserve(gsl::index n) -> void { fValue.reserve(n); }
+    auto Clear() -> void { fValue.clear(); }
+    template<typename U>
+    auto Append(U&& value) -> void;
+
+    auto operator[](gsl::index i) const -> const AValue& { return fValue[i]; }
+    auto operator[](gsl::index i) -> AValue& { return fValue[i]; }
+    auto Copy(gsl::index i) const -> typename AValue::Type { return *fValue[i]; }
+
+    auto Value() const -> const auto& { return fValue; }
+    auto Value() -> auto& { return fValue; }
+
+private:
+    std::vector<AValue> fValue;
+};
+
+/// @brief Column of a `std::vector` value (jagged column), in offsets + values layout.
+/// Values of entry i are [Value()[Offset()[i]], Value()[Offset()[i + 1]]).
+template<typename AValue>
+    requires muc::instantiated_from<typename AValue::Type, std::vector>
+class TupleBatchColumn<AValue> {
+public:
+    using ValueType = AValue;
+
+private:
+    using T = typename AValue::Type::value_type;
+
+public:
+    TupleBatchColumn();
+    TupleBatchColumn(const TupleBatchColumn&) = default;
+    TupleBatchColumn(TupleBatchColumn&& that);
+    auto operator=(const TupleBatchColumn&) -> TupleBatchColumn& = default;
+    auto operator=(TupleBatchColumn&& that) -> TupleBatchColumn&;
+
+    auto Size() const -> gsl::index { return ssize(fOffset) - 1; }
+    auto Reserve(gsl::index n) -> void { fOffset.reserve(n + 1); }
+    auto Clear() -> void;
+    template<std::ranges::common_range R>
+        requires std::convertible_to<std::ranges::range_reference_t<R>, typename AValue::Type::value_type>
+    auto Append(R&& value) -> void;
+
+    auto operator[](gsl::index i) const -> auto { return std::ranges::subrange{fValue.cbegin() + fOffset[i], fValue.cbegin() + fOffset[i + 1]}; }
+    auto operator[](gsl::index i) -> auto { return std::ranges::subrange{fValue.begin() + fOffset[i], fValue.begin() + fOffset[i + 1]}; }
+    auto Copy(gsl::index i) const -> typename AValue::Type { return {fValue.cbegin() + fOffset[i], fValue.cbegin() + fOffset[i + 1]}; }
+
+    auto Offset() const -> const auto& { return fOffset; }
+    auto Value() const -> const auto& { return fValue; }
+    /// @warning Do not change its size, which is fixed by the offsets.
+    auto Value() -> auto& { return fValue; }
+
+private:
+    std::vector<gsl::index> fOffset;
+    std::vector<T> fValue;
+};
+
+} // namespace Mustard::Data::internal
+
+#include "Mustard/Data/internal/TupleBatchColumn.inl"
@@ -0,0 +1,71 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Data::internal {
+
+template<typename AValue>
+TupleBatchColumn<AValue>::TupleBatchColumn() :
+    fValue{} {}
+
+template<typename AValue>
+template<typename U>
+auto TupleBatchColumn<AValue>::Append(U&& value) -> void {
+    if constexpr (IsStdArray<typename AValue::Type>{} and not std::same_as<std::remove_cvref_t<U>, typename AValue::Type>) {
+        std::ranges::copy(value, fValue.emplace_back()->begin()); // e.g. read as ROOT::RVec
+    } else {
+        fValue.emplace_back(std::forward<U>(value));
+    }
+}
+
+template<typename AValue>
+    requires muc::instantiated_from<typename AValue::Type, std::vector>
+TupleBatchColumn<AValue>::TupleBatchColumn() :
+    fOffset{0},
+    fValue{} {}
+
+template<typename AValue>
+    requires muc::instantiated_from<typename AValue::Type, std::vector>
+TupleBatchColumn<AValue>::TupleBatchColumn(TupleBatchColumn&& that) :
+    fOffset{std::exchange(that.fOffset, {0})},
+    fValue{std::exchange(that.fValue, {})} {}
+
+template<typename AValue>
+    requires muc::instantiated_from<typename AValue::Type, std::vector>
+auto TupleBatchColumn<AValue>::operator=(TupleBatchColumn&& that) -> TupleBatchColumn& {
+    fOffset = std::exchange(that.fOffset, {0});
+    fValue = std::exchange(that.fValue, {});
+    return *this;
+}
+
+template<typename AValue>
+    requires muc::instantiated_from<typename AValue::Type, std::vector>
+auto TupleBatchColumn<AValue>::Clear() -> void {
+    fOffset.resize(1);
+    fValue.clear();
+}
+
+template<typename AValue>
+    requires muc::instantiated_from<typename AValue::Type, std::vector>
+template<std::ranges::common_range R>
+    requires std::convertible_to<std::ranges::range_reference_t<R>, typename AValue::Type::value_type>
+auto TupleBatchColumn<AValue>::Append(R&& value) -> void {
+    fValue.insert(fValue.end(), std::ranges::begin(value), std::ranges::end(value));
+    fOffset.push_back(ssize(fValue));
+}
+
+} // namespace Mustard::Data::internal
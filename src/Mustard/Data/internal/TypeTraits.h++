@@ -20,6 +20,7 @@
 
 #include "Mustard/ROOTX/Fundamental.h++"
 
+#include <array>
 #include <type_traits>
 
 namespace Mustard::Data::internal {
@@ -17,11 +17,14 @@
 // Mustard. If not, see <https://www.gnu.org/licenses/>.
 
 #include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/Env/internal/CPUTopology.h++"
 #include "Mustard/IO/PrettyLog.h++"
 #include "Mustard/IO/Print.h++"
 
 #include "TROOT.h"
 
+#include "envparse/parse.h++"
+
 #include "gsl/gsl"
 
 #include "fmt/format.h"
@@ -29,7 +32,9 @@
 #include <algorithm>
 #include <array>
 #include <cstdio>
+#include <functional>
 #include <iterator>
+#include <ranges>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -45,7 +50,13 @@ MPIEnv::MPIEnv(NoBanner, int argc, char* argv[],
     fIntraNodeComm{},
     fInterNodeComm{},
     fLocalNodeID{},
-    fNodeList{} {
+    fNodeList{},
+    fCPUBinding{},
+    fBoundCore{},
+    fBoundCPU{},
+    fLocalNUMADomain{},
+    fIntraNUMAComm{},
+    fCPUBindingMap{} {
     mplr::init(argc, argv);
 
     const auto worldComm{mplr::comm_world()};
@@ -103,6 +114,8 @@ MPIEnv::MPIEnv(NoBanner, int argc, char* argv[],
         std::ranges::copy_n(flatWorldRank.cbegin() + disp[i], nodeSize[i], node.worldRank.begin());
     }
 
+    BindCPU();
+
     // Disable ROOT implicit multi-threading since we are using MPI
     if (ROOT::IsImplicitMTEnabled()) {
         ROOT::DisableImplicitMT();
@@ -132,6 +145,88 @@ MPIEnv::~MPIEnv() {
     fShowBanner = false;
 }
 
+auto MPIEnv::BindThread(int threadID) const -> void {
+    if (fBoundCore.empty()) {
+        return;
+    }
+    const auto& core{fBoundCore[threadID % std::ssize(fBoundCore)]};
+    if (not internal::CPUTopology::Bind(core)) {
+        PrintWarning(fmt::format("Failed to bind worker thread {} to CPU {}", threadID, internal::CPUTopology::FormatCPUList(core)));
+    }
+}
+
+auto MPIEnv::BindCPU() -> void {
+    const auto worldComm{mplr::comm_world()};
+    const auto policy{envparse::parse<envparse::not_set_option::left_blank>("${MUSTARD_CPU_BINDING}")};
+    if (policy == "core") {
+        fCPUBinding = CPUBinding::Core;
+    } else if (policy == "numa") {
+        fCPUBinding = CPUBinding::NUMA;
+    } else if (not policy.empty() and policy != "none" and worldComm.rank() == 0) {
+        PrintWarning(fmt::format("Unknown CPU binding '{}' (available are 'none', 'core' and 'numa'), binding disabled", policy));
+    }
+    const auto requested{fCPUBinding != CPUBinding::None};
+
+    const internal::CPUTopology topology;
+    if (requested) {
+        // processes already bound by the launcher have different affinities
+        const auto affinityHash{static_cast<unsigned long long>(std::hash<std::string>{}(
+            internal::CPUTopology::FormatCPUList(internal::CPUTopology::AffinityCPU())))};
+        auto leaderAffinityHash{affinityHash};
+        fIntraNodeComm.bcast(0, leaderAffinityHash);
+        auto bindable{static_cast<int>(topology.Available() and affinityHash == leaderAffinityHash)};
+        fIntraNodeComm.allreduce(mplr::min<int>{}, bindable);
+        if (not bindable) {
+            if (fIntraNodeComm.rank() == 0) {
+                PrintWarning(fmt::format("CPU binding disabled on '{}' (processes already bound or CPU topology not available)", LocalNode().name));
+            }
+            fCPUBinding = CPUBinding::None;
+        }
+    }
+
+    const auto localRank{fIntraNodeComm.rank()};
+    const auto nLocalRank{fIntraNodeComm.size()};
+    if (fCPUBinding == CPUBinding::Core) {
+        const auto& core{topology.CoreList()};
+        const auto nCore{std::ssize(core)};
+        if (nLocalRank <= nCore) {
+            fBoundCore.assign(core.cbegin() + localRank * nCore / nLocalRank,
+                              core.cbegin() + (localRank + 1) * nCore / nLocalRank);
+        } else {
+            fBoundCore.assign(1, core[localRank % nCore]);
+        }
+        for (auto&& cpu : fBoundCore) {
+            fBoundCPU.insert(fBoundCPU.end(), cpu.cbegin(), cpu.cend());
+        }
+        std::ranges::sort(fBoundCPU);
+    } else if (fCPUBinding == CPUBinding::NUMA) {
+        const auto& numaDomain{topology.NUMADomainList()};
+        fBoundCPU = numaDomain[localRank * std::ssize(numaDomain) / nLocalRank].cpu;
+    }
+    if (not fBoundCPU.empty() and not internal::CPUTopology::Bind(fBoundCPU)) {
+        PrintWarning(fmt::format("Failed to bind process to CPU {}", internal::CPUTopology::FormatCPUList(fBoundCPU)));
+        fBoundCore.clear();
+        fBoundCPU.clear();
+    }
+
+    fLocalNUMADomain = topology.NUMADomainOf(fBoundCPU.empty() ? internal::CPUTopology::CurrentCPU() : fBoundCPU.front());
+    fIntraNUMAComm = mplr::communicator{mplr::communicator::split, fIntraNodeComm, fLocalNUMADomain};
+
+    if (not requested) {
+        return;
+    }
+    using BindingType = std::array<char, 128>;
+    BindingType binding{};
+    const auto bindingText{fmt::format("NUMA {}, CPU {}", fLocalNUMADomain,
+                                       fBoundCPU.empty() ? "not bound" : internal::CPUTopology::FormatCPUList(fBoundCPU))};
+    std::ranges::copy(bindingText | std::views::take(binding.size() - 1), binding.begin());
+    std::vector<BindingType> bindingMap(worldComm.rank() == 0 ? worldComm.size() : 0);
+    worldComm.gather(0, binding, bindingMap.data());
+    for (auto&& b : bindingMap) {
+        fCPUBindingMap.emplace_back(b.cbegin(), std::ranges::find(std::as_const(b), '\0'));
+    }
+}
+
 auto MPIEnv::PrintStartBannerBody(int argc, char* argv[]) const -> void {
     BasicEnv::PrintStartBannerBody(argc, argv);
     // MPI library version
@@ -185,6 +280,15 @@ auto MPIEnv::PrintStartBannerBody(int argc, char* argv[]) const -> void {
             VPrint(stdout, fmt::emphasis::bold, format, fmt::make_format_args(node.name, rankString, nRank));
         }
     }
+    if (not fCPUBindingMap.empty()) {
+        Print(fmt::emphasis::bold, " CPU binding:\n");
+        const auto rankWidth{fmt::formatted_size("{}", fCPUBindingMap.size() - 1)};
+        for (auto&& node : fNodeList) {
+            for (auto&& rank : node.worldRank) {
+                Print(fmt::emphasis::bold, "  Rank {:>{}} on '{}': {}\n", rank, rankWidth, node.name, fCPUBindingMap[rank]);
+            }
+        }
+    }
 }
 
 } // namespace Mustard::Env
@@ -35,6 +35,19 @@
 
 namespace Mustard::Env {
 
+/// @brief CPU binding policy of MPI processes, read from the environment
+/// variable MUSTARD_CPU_BINDING ("none", "core" or "numa"; default "none").
+/// Core: processes on a node share its physical cores in contiguous blocks,
+/// and worker threads are pinned to single cores of their process.
+/// NUMA: processes on a node are distributed over its NUMA domains, and
+/// bound to all CPUs of their domain.
+/// Binding is skipped if the launcher has already bound the processes.
+enum struct CPUBinding {
+    None,
+    Core,
+    NUMA
+};
+
 class MPIEnv : virtual public BasicEnv,
                public Memory::PassiveSingleton<MPIEnv> {
 protected:
@@ -58,6 +71,8 @@ public:
 
     auto IntraNodeComm() const -> const auto& { return fIntraNodeComm; }
     auto InterNodeComm() const -> const auto& { return fInterNodeComm; }
+    /// @brief Processes in the same NUMA domain, e.g. for NUMA-local shared windows.
+    auto IntraNUMAComm() const -> const auto& { return fIntraNUMAComm; }
 
     auto LocalNodeID() const -> const auto& { return fLocalNodeID; }
     auto LocalNode() const -> const auto& { return fNodeList[fLocalNodeID]; }
@@ -67,9 +82,20 @@ public:
     auto OnSingleNode() const -> auto { return ClusterSize() == 1; }
     auto OnCluster() const -> auto { return ClusterSize() != 1; }
 
+    auto CPUBinding() const -> auto { return fCPUBinding; }
+    /// @brief Logical CPUs this process is bound to, empty if not bound.
+    auto BoundCPU() const -> const auto& { return fBoundCPU; }
+    auto LocalNUMADomain() const -> auto { return fLocalNUMADomain; }
+    /// @brief Pin the calling worker thread to a core of this process
+    /// under core binding, otherwise do nothing.
+    auto BindThread(int threadID) const -> void;
+
 protected:
     auto PrintStartBannerBody(int argc, char* argv[]) const -> void;
 
+private:
+    auto BindCPU() -> void;
+
 private:
     struct Node {
         std::string name;
@@ -83,6 +109,13 @@ private:
 
     int fLocalNodeID;
     std::vector<struct Node> fNodeList;
+
+    enum CPUBinding fCPUBinding;
+    std::vector<std::vector<int>> fBoundCore;
+    std::vector<int> fBoundCPU;
+    int fLocalNUMADomain;
+    mplr::communicator fIntraNUMAComm;
+    std::vector<std::string> fCPUBindingMap;
 };
 
 } // namespace Mustard::Env
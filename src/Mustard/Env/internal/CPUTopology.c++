@@ -0,0 +1,183 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Env/internal/CPUTopology.h++"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <system_error>
+#include <tuple>
+
+#if defined __linux__
+#    include <sched.h>
+#endif
+
+namespace Mustard::Env::internal {
+
+namespace {
+
+auto ReadLine(const std::filesystem::path& file) -> std::string {
+    std::ifstream is{file};
+    std::string line;
+    std::getline(is, line);
+    return line;
+}
+
+auto ReadInt(const std::filesystem::path& file, int fallback) -> int {
+    const auto line{ReadLine(file)};
+    auto value{fallback};
+    std::from_chars(line.data(), line.data() + line.size(), value);
+    return value;
+}
+
+} // namespace
+
+CPUTopology::CPUTopology() :
+    fCoreList{},
+    fNUMADomainList{},
+    fNUMADomainOfCPU{} {
+    const auto allowed{AffinityCPU()};
+    if (allowed.empty()) {
+        return;
+    }
+    const std::filesystem::path sysfs{"/sys/devices/system"};
+
+    fNUMADomainOfCPU.assign(allowed.back() + 1, 0);
+    std::error_code error;
+    for (auto&& entry : std::filesystem::directory_iterator{sysfs / "node", error}) {
+        const auto name{entry.path().filename().string()};
+        int id;
+        const auto [end, errc]{std::from_chars(name.data() + std::min<std::size_t>(4, name.size()), name.data() + name.size(), id)};
+        if (not name.starts_with("node") or errc != std::errc{} or end != name.data() + name.size()) {
+            continue;
+        }
+        for (auto&& cpu : ParseCPUList(ReadLine(entry.path() / "cpulist"))) {
+            if (cpu < std::ssize(fNUMADomainOfCPU)) {
+                fNUMADomainOfCPU[cpu] = id;
+            }
+        }
+    }
+
+    std::map<std::tuple<int, int, int>, std::vector<int>> core;
+    std::map<int, std::vector<int>> numaDomain;
+    for (auto&& cpu : allowed) {
+        const auto topology{sysfs / fmt::format("cpu/cpu{}/topology", cpu)};
+        const auto numa{NUMADomainOf(cpu)};
+        core[{numa, ReadInt(topology / "physical_package_id", 0), ReadInt(topology / "core_id", cpu)}].push_back(cpu);
+        numaDomain[numa].push_back(cpu);
+    }
+    fCoreList.reserve(core.size());
+    for (auto&& [_, cpu] : core) {
+        fCoreList.emplace_back(std::move(cpu));
+    }
+    fNUMADomainList.reserve(numaDomain.size());
+    for (auto&& [id, cpu] : numaDomain) {
+        fNUMADomainList.push_back({id, std::move(cpu)});
+    }
+}
+
+auto CPUTopology::NUMADomainOf(int cpu) const -> int {
+    return 0 <= cpu and cpu < std::ssize(fNUMADomainOfCPU) ? fNUMADomainOfCPU[cpu] : 0;
+}
+
+auto CPUTopology::AffinityCPU() -> std::vector<int> {
+    std::vector<int> cpu;
+#if defined __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) != 0) {
+        return cpu;
+    }
+    for (int i{}; i < CPU_SETSIZE; ++i) {
+        if (CPU_ISSET(i, &set)) {
+            cpu.emplace_back(i);
+        }
+    }
+#endif
+    return cpu;
+}
+
+auto CPUTopology::CurrentCPU() -> int {
+#if defined __linux__
+    return sched_getcpu();
+#else
+    return -1;
+#endif
+}
+
+auto CPUTopology::Bind(const std::vector<int>& cpu) -> bool {
+#if defined __linux__
+    if (cpu.empty()) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (auto&& i : cpu) {
+        CPU_SET(i, &set);
+    }
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    static_cast<void>(cpu);
+    return false;
+#endif
+}
+
+auto CPUTopology::ParseCPUList(std::string_view list) -> std::vector<int> {
+    std::vector<int> cpu;
+    while (not list.empty()) {
+        const auto comma{std::min(list.find(','), list.size())};
+        const auto item{list.substr(0, comma)};
+        list.remove_prefix(std::min(comma + 1, list.size()));
+        int first;
+        const auto [dash, errc]{std::from_chars(item.data(), item.data() + item.size(), first)};
+        if (errc != std::errc{}) {
+            continue;
+        }
+        auto last{first};
+        if (dash != item.data() + item.size() and *dash == '-') {
+            std::from_chars(dash + 1, item.data() + item.size(), last);
+        }
+        for (auto i{first}; i <= last; ++i) {
+            cpu.emplace_back(i);
+        }
+    }
+    return cpu;
+}
+
+auto CPUTopology::FormatCPUList(const std::vector<int>& cpu) -> std::string {
+    std::string list;
+    for (auto it{cpu.cbegin()}; it != cpu.cend();) {
+        const auto first{*it};
+        auto last{first};
+        while (++it != cpu.cend() and *it == last + 1) {
+            ++last;
+        }
+        list.append(first == last ? fmt::format("{},", first) : fmt::format("{}-{},", first, last));
+    }
+    if (not list.empty()) {
+        list.pop_back(); // remove last ','
+    }
+    return list;
+}
+
+} // namespace Mustard::Env::internal
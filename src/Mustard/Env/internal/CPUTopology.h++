@@ -0,0 +1,66 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Mustard::Env::internal {
+
+/// @brief Logical CPUs available to the calling thread, grouped by physical
+/// core and by NUMA domain. Read from the Linux sysfs (/sys/devices/system),
+/// empty on other platforms.
+class CPUTopology {
+public:
+    struct NUMADomain {
+        int id;
+        std::vector<int> cpu;
+    };
+
+public:
+    CPUTopology();
+
+    auto Available() const -> bool { return not fCoreList.empty(); }
+    /// @brief Physical cores as lists of logical CPUs, ordered by NUMA domain, package and core ID.
+    auto CoreList() const -> const auto& { return fCoreList; }
+    auto NUMADomainList() const -> const auto& { return fNUMADomainList; }
+    /// @return NUMA domain ID of a logical CPU, 0 if unknown
+    auto NUMADomainOf(int cpu) const -> int;
+
+    /// @brief Logical CPUs the calling thread is allowed to run on.
+    static auto AffinityCPU() -> std::vector<int>;
+    /// @brief Logical CPU the calling thread is running on, -1 if unknown.
+    static auto CurrentCPU() -> int;
+    /// @brief Restrict the calling thread to a set of logical CPUs.
+    /// @return true on success
+    static auto Bind(const std::vector<int>& cpu) -> bool;
+
+    /// @brief Parse a sysfs CPU list, e.g. "0-3,8,10-11".
+    static auto ParseCPUList(std::string_view list) -> std::vector<int>;
+    /// @brief Format a sorted list of CPUs as a sysfs CPU list.
+    static auto FormatCPUList(const std::vector<int>& cpu) -> std::string;
+
+private:
+    std::vector<std::vector<int>> fCoreList;
+    std::vector<NUMADomain> fNUMADomainList;
+    std::vector<int> fNUMADomainOfCPU;
+};
+
+} // namespace Mustard::Env::internal
@@ -0,0 +1,55 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <chrono>
+#include <concepts>
+#include <future>
+#include <utility>
+
+namespace Mustard::inline Execution {
+
+template<std::integral T>
+class Executor;
+
+/// @brief Handle of a task loop launched by Executor::Launch.
+///
+/// Move-only. Like a future from std::async, destroying a handle whose loop
+/// is still running waits for the loop to finish.
+template<std::integral T>
+class AsyncExecution final {
+public:
+    auto Valid() const -> bool { return fFuture.valid(); }
+    /// @brief Whether the loop has finished on this process. Does not block.
+    auto Ready() const -> bool { return fFuture.wait_for(std::chrono::seconds::zero()) == std::future_status::ready; }
+    auto Wait() const -> void { fFuture.wait(); }
+    /// @brief Wait for the loop and return the number of locally executed tasks.
+    /// Rethrows an exception thrown by the loop. The handle becomes invalid.
+    auto Get() -> T { return fFuture.get(); }
+
+private:
+    friend class Executor<T>;
+    AsyncExecution(std::future<T> future) :
+        fFuture{std::move(future)} {}
+
+private:
+    std::future<T> fFuture;
+};
+
+} // namespace Mustard::inline Execution
@@ -200,6 +200,7 @@ auto ClusterAwareMasterWorkerScheduler<T>::PreTaskAction() -> void {
     if (fIntraNodeTaskCounter == 0) {
         fRecvFromNM.start();
         fSendToNM.start();
+        this->CountMessage(2);
     }
 }
 
@@ -0,0 +1,93 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/Execution/Scheduler.h++"
+#include "Mustard/IO/PrettyLog.h++"
+
+#include "mplr/mplr.hpp"
+
+#include "gsl/gsl"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Mustard::inline Execution {
+
+/// @brief Static scheduler for tasks with costs known in advance.
+///
+/// Tasks are assigned by the longest-processing-time-first rule: in order of
+/// decreasing cost, each task goes to the process with the least assigned cost.
+/// Every process computes the same assignment, so there is no communication
+/// during the loop. Costs must therefore be identical on all processes.
+///
+/// In node-aware mode, tasks are first assigned to nodes, where the load of a
+/// node is its cost divided by its number of processes, then to processes in
+/// each node. Tasks of a node stay together (e.g. for node-local caches) and
+/// nodes with different numbers of processes are balanced.
+template<std::integral T>
+class CostWeightedScheduler : public Scheduler<T> {
+public:
+    /// @param cost cost of task first + i at index i
+    explicit CostWeightedScheduler(std::vector<double> cost);
+    /// @param cost cost of a task, called once per task on each process
+    explicit CostWeightedScheduler(std::function<auto(T)->double> cost);
+
+    auto NodeAware() const -> auto { return fNodeAware; }
+    auto NodeAware(bool a) -> void { fNodeAware = a; }
+    /// @brief Tasks assigned to this process, in ascending order.
+    auto LocalTaskList() const -> const auto& { return fLocalTaskList; }
+
+    virtual auto PreLoopAction() -> void override;
+    virtual auto PreTaskAction() -> void override {}
+    virtual auto PostTaskAction() -> void override;
+    virtual auto PostLoopAction() -> void override {}
+
+    virtual auto NExecutedTaskEstimation() const -> std::pair<bool, T> override;
+
+private:
+    auto CostList() const -> std::vector<double>;
+    /// @brief LPT assignment of tasks (sorted by decreasing cost) to workers.
+    /// @return worker index of each task
+    static auto Assign(const std::vector<T>& task, const std::vector<double>& cost, int nWorker) -> std::vector<int>;
+
+private:
+    std::vector<double> fCost;
+    std::function<auto(T)->double> fCostFunction;
+    bool fNodeAware;
+
+    std::vector<T> fLocalTaskList;
+    typename std::vector<T>::size_type fLocalTaskIndex;
+};
+
+} // namespace Mustard::inline Execution
+
+#include "Mustard/Execution/CostWeightedScheduler.inl"
@@ -0,0 +1,145 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::inline Execution {
+
+template<std::integral T>
+CostWeightedScheduler<T>::CostWeightedScheduler(std::vector<double> cost) :
+    Scheduler<T>{},
+    fCost{std::move(cost)},
+    fCostFunction{},
+    fNodeAware{},
+    fLocalTaskList{},
+    fLocalTaskIndex{} {}
+
+template<std::integral T>
+CostWeightedScheduler<T>::CostWeightedScheduler(std::function<auto(T)->double> cost) :
+    Scheduler<T>{},
+    fCost{},
+    fCostFunction{std::move(cost)},
+    fNodeAware{},
+    fLocalTaskList{},
+    fLocalTaskIndex{} {}
+
+template<std::integral T>
+auto CostWeightedScheduler<T>::PreLoopAction() -> void {
+    const auto cost{CostList()};
+    // task offsets by decreasing cost, ties in task order, identical on all processes
+    std::vector<T> order(this->NTask());
+    std::iota(order.begin(), order.end(), T{});
+    std::ranges::stable_sort(order, std::greater{}, [&cost](T i) { return cost[i]; });
+
+    // without MPI this process is the only worker
+    const auto mpiAvailable{mplr::available()};
+    const auto rank{mpiAvailable ? mplr::comm_world().rank() : 0};
+    const auto size{mpiAvailable ? mplr::comm_world().size() : 1};
+    fLocalTaskList.clear();
+    if (fNodeAware and mpiAvailable) {
+        const auto& mpiEnv{Env::MPIEnv::Instance()};
+        const auto& nodeList{mpiEnv.NodeList()};
+        // few nodes, a linear search for the node finishing first is enough
+        std::vector<double> nodeLoad(nodeList.size());
+        std::vector<T> localNodeOrder;
+        for (auto i : order) {
+            int node{};
+            for (int j{1}; j < std::ssize(nodeList); ++j) {
+                if ((nodeLoad[j] + cost[i]) / nodeList[j].size < (nodeLoad[node] + cost[i]) / nodeList[node].size) {
+                    node = j;
+                }
+            }
+            nodeLoad[node] += cost[i];
+            if (node == mpiEnv.LocalNodeID()) {
+                localNodeOrder.emplace_back(i);
+            }
+        }
+        const auto& worldRank{mpiEnv.LocalNode().worldRank};
+        const auto worker{static_cast<int>(std::ranges::find(worldRank, rank) - worldRank.cbegin())};
+        const auto assignment{Assign(localNodeOrder, cost, worldRank.size())};
+        for (gsl::index k{}; k < std::ssize(localNodeOrder); ++k) {
+            if (assignment[k] == worker) {
+                fLocalTaskList.emplace_back(this->fTask.first + localNodeOrder[k]);
+            }
+        }
+    } else {
+        const auto assignment{Assign(order, cost, size)};
+        for (gsl::index k{}; k < std::ssize(order); ++k) {
+            if (assignment[k] == rank) {
+                fLocalTaskList.emplace_back(this->fTask.first + order[k]);
+            }
+        }
+    }
+    std::ranges::sort(fLocalTaskList);
+
+    fLocalTaskIndex = 0;
+    this->fExecutingTask = fLocalTaskList.empty() ? this->fTask.last : fLocalTaskList.front();
+}
+
+template<std::integral T>
+auto CostWeightedScheduler<T>::PostTaskAction() -> void {
+    this->fExecutingTask = ++fLocalTaskIndex < fLocalTaskList.size() ? fLocalTaskList[fLocalTaskIndex] : this->fTask.last;
+}
+
+template<std::integral T>
+auto CostWeightedScheduler<T>::NExecutedTaskEstimation() const -> std::pair<bool, T> {
+    if (fLocalTaskList.empty()) {
+        return {false, 0};
+    }
+    // balanced by cost, so progress of this process is representative
+    return {this->fNLocalExecutedTask > 10,
+            static_cast<T>(static_cast<double>(this->fNLocalExecutedTask) / fLocalTaskList.size() * this->NTask())};
+}
+
+template<std::integral T>
+auto CostWeightedScheduler<T>::CostList() const -> std::vector<double> {
+    std::vector<double> cost;
+    if (fCostFunction) {
+        cost.resize(this->NTask());
+        for (T i{}; i < this->NTask(); ++i) {
+            cost[i] = fCostFunction(this->fTask.first + i);
+        }
+    } else {
+        if (std::ssize(fCost) != static_cast<std::ptrdiff_t>(this->NTask())) {
+            Throw<std::invalid_argument>(fmt::format("Size of cost list ({}) != number of tasks ({})", fCost.size(), this->NTask()));
+        }
+        cost = fCost;
+    }
+    if (const auto invalid{std::ranges::find_if(cost, [](auto c) { return not std::isfinite(c) or c < 0; })};
+        invalid != cost.cend()) {
+        Throw<std::invalid_argument>(fmt::format("Invalid cost ({}) of task {}", *invalid, this->fTask.first + (invalid - cost.cbegin())));
+    }
+    return cost;
+}
+
+template<std::integral T>
+auto CostWeightedScheduler<T>::Assign(const std::vector<T>& task, const std::vector<double>& cost, int nWorker) -> std::vector<int> {
+    // min-heap of (load, worker), ties go to the lower worker index
+    std::priority_queue<std::pair<double, int>, std::vector<std::pair<double, int>>, std::greater<>> worker;
+    for (int i{}; i < nWorker; ++i) {
+        worker.emplace(0, i);
+    }
+    std::vector<int> assignment(task.size());
+    for (gsl::index k{}; k < std::ssize(task); ++k) {
+        auto [load, i]{worker.top()};
+        worker.pop();
+        assignment[k] = i;
+        worker.emplace(load + cost[task[k]], i);
+    }
+    return assignment;
+}
+
+} // namespace Mustard::inline Execution
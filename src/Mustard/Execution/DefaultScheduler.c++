@@ -18,20 +18,25 @@
 
 #include "Mustard/Env/MPIEnv.h++"
 #include "Mustard/Execution/DefaultScheduler.h++"
+#include "Mustard/IO/PrettyLog.h++"
 
 #include "mplr/mplr.hpp"
 
 #include "envparse/parse.h++"
 
+#include "fmt/core.h"
+
 #include <algorithm>
+#include <atomic>
+#include <string_view>
+#include <thread>
+#include <utility>
 
 namespace Mustard::inline Execution {
 
-auto DefaultSchedulerCode() -> std::string {
-    if (const auto envScheduler{envparse::parse<envparse::not_set_option::left_blank>("${MUSTARD_EXECUTION_SCHEDULER}")};
-        not envScheduler.empty()) {
-        return envScheduler;
-    }
+namespace {
+
+auto AutoSchedulerCode() -> std::string {
     if (not mplr::available()) {
         return "seq";
     }
@@ -47,7 +52,62 @@ auto DefaultSchedulerCode() -> std::string {
         std::ranges::all_of(mpiEnv.NodeList(), [](auto&& n) { return n.size <= 8; })) {
         return "mw";
     }
-    return "clmw";
+    // clmw still funnels the batch requests of all nodes into rank 0, which
+    // becomes a hotspot at 2000+ ranks. The work-stealing scheduler has no master.
+    if (worldComm.size() < 2048) {
+        return "clmw";
+    }
+    return "ws";
+}
+
+} // namespace
+
+auto DefaultSchedulerCode() -> std::string {
+    if (const auto envScheduler{envparse::parse<envparse::not_set_option::left_blank>("${MUSTARD_EXECUTION_SCHEDULER}")};
+        not envScheduler.empty()) {
+        // multithreading is opt-in per executor, tasks of a default executor may not be thread-safe
+        auto [scheduler, multithreading]{ParseSchedulerCode(envScheduler)};
+        static std::atomic_flag warned;
+        if (multithreading and not warned.test_and_set()) {
+            PrintWarning(fmt::format("Multithreading in MUSTARD_EXECUTION_SCHEDULER={} ignored, "
+                                     "it can only be enabled per executor",
+                                     envScheduler));
+        }
+        return std::move(scheduler);
+    }
+    return AutoSchedulerCode();
+}
+
+auto ParseSchedulerCode(std::string_view scheduler) -> std::pair<std::string, bool> {
+    if (scheduler == "mt" or scheduler == "mpi+mt") {
+        return {AutoSchedulerCode(), true};
+    }
+    constexpr std::string_view multithreadingSuffix{"+mt"};
+    if (scheduler.ends_with(multithreadingSuffix)) {
+        scheduler.remove_suffix(multithreadingSuffix.size());
+        return {std::string{scheduler}, true};
+    }
+    return {std::string{scheduler}, false};
+}
+
+auto DefaultNThreadPerProcess() -> int {
+    const auto nHardwareThread{std::max(1, static_cast<int>(std::thread::hardware_concurrency()))};
+    if (not mplr::available() or not Env::MPIEnv::Available()) {
+        return nHardwareThread;
+    }
+    const auto& mpiEnv{Env::MPIEnv::Instance()};
+    if (const auto& boundCPU{mpiEnv.BoundCPU()}; not boundCPU.empty()) {
+        // all processes bound to a NUMA domain share its CPUs
+        const auto nSharing{mpiEnv.CPUBinding() == Env::CPUBinding::NUMA ? mpiEnv.IntraNUMAComm().size() : 1};
+        return std::max(1, static_cast<int>(boundCPU.size()) / nSharing);
+    }
+    return std::max(1, nHardwareThread / mpiEnv.IntraNodeComm().size());
+}
+
+auto BindWorkerThread(int threadID) -> void {
+    if (mplr::available() and Env::MPIEnv::Available()) {
+        Env::MPIEnv::Instance().BindThread(threadID);
+    }
 }
 
 } // namespace Mustard::inline Execution
@@ -19,11 +19,14 @@
 #pragma once
 
 #include "Mustard/Execution/ClusterAwareMasterWorkerScheduler.h++"
+#include "Mustard/Execution/CostWeightedScheduler.h++"
+#include "Mustard/Execution/HierarchicalSharedMemoryScheduler.h++"
 #include "Mustard/Execution/MasterWorkerScheduler.h++"
 #include "Mustard/Execution/Scheduler.h++"
 #include "Mustard/Execution/SequentialScheduler.h++"
 #include "Mustard/Execution/SharedMemoryScheduler.h++"
 #include "Mustard/Execution/StaticScheduler.h++"
+#include "Mustard/Execution/WorkStealingScheduler.h++"
 
 #include "muc/algorithm"
 #include "muc/hash_map"
@@ -36,12 +39,33 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 namespace Mustard::inline Execution {
 
+/// @brief Scheduler code from MUSTARD_EXECUTION_SCHEDULER, or selected automatically
+/// ("seq" for one process, "shm" on one node, "mw" or "clmw" up to 2047 processes,
+/// "ws" beyond).
+/// Never multithreaded: tasks of a default executor are not assumed to be thread-safe,
+/// so "+mt" must be requested by the executor itself.
 auto DefaultSchedulerCode() -> std::string;
 
+/// @brief Split a scheduler code into the MPI scheduler code and a multithreading flag.
+/// "<code>+mt" runs a work-stealing thread pool inside each process under scheduler
+/// <code>; "mt" or "mpi+mt" does so under the automatically selected scheduler.
+/// @return (scheduler code without "+mt", multithreading flag)
+auto ParseSchedulerCode(std::string_view scheduler) -> std::pair<std::string, bool>;
+
+/// @brief Number of threads per process in multithreading mode, i.e. the
+/// number of CPUs the process is bound to (divided among the processes bound
+/// to the same NUMA domain), or otherwise hardware concurrency shared by
+/// processes on the same node.
+auto DefaultNThreadPerProcess() -> int;
+
+/// @brief Pin the calling worker thread according to the CPU binding of the process.
+auto BindWorkerThread(int threadID) -> void;
+
 template<std::integral T>
 auto MakeCodedScheduler(std::string_view scheduler) -> std::unique_ptr<Scheduler<T>>;
 
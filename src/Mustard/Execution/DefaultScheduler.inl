@@ -22,13 +22,15 @@ template<std::integral T>
 auto MakeCodedScheduler(std::string_view scheduler) -> std::unique_ptr<Scheduler<T>> {
     static const muc::flat_hash_map<std::string_view, std::function<auto()->std::unique_ptr<Scheduler<T>>>> schedulerMap{
         {"clmw", [] { return std::make_unique<ClusterAwareMasterWorkerScheduler<T>>(); }},
+        {"hshm", [] { return std::make_unique<HierarchicalSharedMemoryScheduler<T>>(); }},
         {"mw",   [] { return std::make_unique<MasterWorkerScheduler<T>>(); }            },
         {"seq",  [] { return std::make_unique<SequentialScheduler<T>>(); }              },
         {"shm",  [] { return std::make_unique<SharedMemoryScheduler<T>>(); }            },
-        {"stat", [] { return std::make_unique<StaticScheduler<T>>(); }                  }
+        {"stat", [] { return std::make_unique<StaticScheduler<T>>(); }                  },
+        {"ws",   [] { return std::make_unique<WorkStealingScheduler<T>>(); }            }
     };
     try {
-        return schedulerMap.at(scheduler)();
+        return schedulerMap.at(ParseSchedulerCode(scheduler).first)();
     } catch (const std::out_of_range&) {
         std::vector<std::string_view> available(schedulerMap.size());
         std::ranges::transform(schedulerMap, available.begin(), [](auto&& s) { return s.first; });
@@ -18,19 +18,32 @@
 
 #pragma once
 
+#include "Mustard/Execution/AsyncExecution.h++"
 #include "Mustard/Execution/DefaultScheduler.h++"
 #include "Mustard/Execution/Scheduler.h++"
 #include "Mustard/Execution/internal/ExecutorImplBase.h++"
 #include "Mustard/Execution/internal/ParallelExecutorImpl.h++"
 #include "Mustard/Execution/internal/SequentialExecutorImpl.h++"
+#include "Mustard/Execution/internal/WorkStealingThreadPool.h++"
+#include "Mustard/IO/PrettyLog.h++"
 
 #include "mplr/mplr.hpp"
 
+#include "gsl/gsl"
+
 #include <concepts>
+#include <filesystem>
+#include <functional>
+#include <future>
 #include <memory>
+#include <ranges>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 #include <variant>
+#include <vector>
 
 namespace Mustard::inline Execution {
 
@@ -41,6 +54,9 @@ public:
     using ExecutionInfoType = typename internal::ExecutorImplBase<T>::ExecutionInfoType;
 
 public:
+    /// @brief With MPI, construction is collective over the world communicator: a parallel
+    /// executor duplicates it for its own use. Construct (and destroy) executors in the same
+    /// order on all processes, e.g. not inside a rank-dependent branch.
     Executor(std::string_view scheduler = DefaultSchedulerCode());
     Executor(std::string executionName, std::string taskName, std::string_view scheduler = DefaultSchedulerCode());
     Executor(std::unique_ptr<Scheduler<T>> scheduler);
@@ -50,11 +66,17 @@ public:
     auto SwitchScheduler(std::unique_ptr<Scheduler<T>> scheduler) -> void;
 
     auto NProcess() const -> int;
+    auto NThread() const -> int;
+    auto NThread(int n) -> void;
+    auto BatchPolicy() const -> enum BatchPolicy;
+    auto BatchPolicy(enum BatchPolicy policy) -> void;
 
     auto Task() const -> struct Scheduler<T>::Task;
     auto NTask() const -> T;
     auto ExecutingTask() const -> T;
     auto NLocalExecutedTask() const -> T;
+    /// @brief Tasks passed by the loop on this process, safe to poll during Launch.
+    auto LocalProgress() const -> T;
 
     auto Executing() const -> bool;
 
@@ -62,22 +84,73 @@ public:
     auto PrintProgress(bool print) -> void;
     auto PrintProgressInterval() const -> muc::chrono::seconds<double>;
     auto PrintProgressInterval(muc::chrono::seconds<double> t) -> void;
+    auto Profile() const -> bool;
+    /// @brief Measure task durations and time spent in the scheduler, reported in
+    /// ExecutionInfo. Costs a few clock reads per task, disabled by default.
+    auto Profile(bool profile) -> void;
+
+    auto Journal() const -> const std::filesystem::path&;
+    auto Journal(std::filesystem::path path) -> void;
+    auto JournalInterval() const -> muc::chrono::seconds<double>;
+    auto JournalInterval(muc::chrono::seconds<double> t) -> void;
+
+    auto PreTaskHook() const -> const std::function<auto(T)->void>&;
+    /// @brief Set a function called with the task ID before each task, in the thread
+    /// running the task, e.g. to reseed random engines per task. Empty to disable.
+    auto PreTaskHook(std::function<auto(T)->void> hook) -> void;
+    auto Lookahead() const -> int;
+    /// @brief Set the number of tasks scheduled ahead of the executing one (single thread only,
+    /// with multiple threads the thread pool bounds the tasks in flight). With 0 (default), a task
+    /// finishes before its scheduler post-task action and the scheduling of the next one.
+    auto Lookahead(int n) -> void;
+    auto LookaheadHook() const -> const std::function<auto(T)->void>&;
+    /// @brief Set a function called with the task ID once the task is scheduled to this process,
+    /// in the order of scheduling and in the thread driving the scheduler, e.g. to prefetch
+    /// the input of the task. Empty to disable.
+    auto LookaheadHook(std::function<auto(T)->void> hook) -> void;
 
     auto ExecutionName() const -> const std::string&;
     auto ExecutionName(std::string name) -> void;
     auto TaskName() const -> const std::string&;
     auto TaskName(std::string name) -> void;
 
+    /// @brief Run the task loop, throws if a loop of this executor is already executing.
     auto operator()(struct Scheduler<T>::Task task, std::invocable<T> auto&& F) -> T;
     auto operator()(T size, std::invocable<T> auto&& F) -> T;
 
+    /// @brief Run the task loop in a separate thread and return immediately.
+    /// Each executor communicates over its own duplicate of the world communicator,
+    /// so loops of different executors can be in flight together. Executors must
+    /// be launched in the same order on all processes.
+    /// @note The executor may be moved, but must not be used or destroyed until the loop has finished.
+    /// Tasks of concurrent loops must not share unsynchronized state, e.g. the
+    /// global random engine.
+    auto Launch(struct Scheduler<T>::Task task, std::invocable<T> auto&& F) -> AsyncExecution<T>;
+    auto Launch(T size, std::invocable<T> auto&& F) -> AsyncExecution<T>;
+
+    /// @brief Combine Map(taskID) of all tasks with Combine, result available on all processes.
+    /// init is the identity of Combine. A must be transferable by mplr.
+    /// @note Combine must be associative and commutative: partial results are combined per
+    /// thread and per process in the order tasks happen to be scheduled, which is not reproducible.
+    /// A task journal cannot be used, since tasks completed in a previous run would be skipped.
+    template<typename A>
+    auto Reduce(struct Scheduler<T>::Task task, A init, std::invocable<T> auto&& Map, std::invocable<A, A> auto&& Combine) -> A;
+    template<typename A>
+    auto Reduce(T size, A init, std::invocable<T> auto&& Map, std::invocable<A, A> auto&& Combine) -> A;
+
     auto ExecutionInfo() const -> const ExecutionInfoType&;
     auto PrintExecutionSummary() const -> void;
+    /// @brief Write execution info of each process and the total to a .json or .csv file (on rank 0).
+    auto WriteExecutionInfo(const std::filesystem::path& path) const -> void;
 
 private:
     using Impl = std::variant<internal::ParallelExecutorImpl<T>,
                               internal::SequentialExecutorImpl<T>>;
 
+    static auto Claim(Impl& impl) -> void;
+    static auto Release(Impl& impl) -> void;
+    static auto Run(Impl& impl, struct Scheduler<T>::Task task, std::invocable<T> auto&& F) -> T;
+
 private:
     std::unique_ptr<Impl> fImpl;
 };
@@ -20,11 +20,15 @@ namespace Mustard::inline Execution {
 
 template<std::integral T>
 Executor<T>::Executor(std::string_view scheduler) :
-    Executor{MakeCodedScheduler<T>(scheduler)} {}
+    Executor{"Execution", "Task", scheduler} {}
 
 template<std::integral T>
 Executor<T>::Executor(std::string executionName, std::string taskName, std::string_view scheduler) :
-    Executor{std::move(executionName), std::move(taskName), MakeCodedScheduler<T>(scheduler)} {}
+    Executor{std::move(executionName), std::move(taskName), MakeCodedScheduler<T>(scheduler)} {
+    if (ParseSchedulerCode(scheduler).second) {
+        NThread(DefaultNThreadPerProcess());
+    }
+}
 
 template<std::integral T>
 Executor<T>::Executor(std::unique_ptr<Scheduler<T>> scheduler) :
@@ -67,6 +71,38 @@ auto Executor<T>::NProcess() const -> int {
                       *fImpl);
 }
 
+template<std::integral T>
+auto Executor<T>::NThread() const -> int {
+    return std::visit([&](auto&& impl) {
+        return impl.NThread();
+    },
+                      *fImpl);
+}
+
+template<std::integral T>
+auto Executor<T>::NThread(int n) -> void {
+    std::visit([&](auto&& impl) {
+        impl.NThread(n);
+    },
+               *fImpl);
+}
+
+template<std::integral T>
+auto Executor<T>::BatchPolicy() const -> enum BatchPolicy {
+    return std::visit([&](auto&& impl) {
+        return impl.BatchPolicy();
+    },
+                      *fImpl);
+}
+
+template<std::integral T>
+auto Executor<T>::BatchPolicy(enum BatchPolicy policy) -> void {
+    std::visit([&](auto&& impl) {
+        impl.BatchPolicy(policy);
+    },
+               *fImpl);
+}
+
 template<std::integral T>
 auto Executor<T>::Task() const -> struct Scheduler<T>::Task {
     return std::visit([&](auto&& impl) {
@@ -99,6 +135,14 @@ auto Executor<T>::NLocalExecutedTask() const -> T {
                       *fImpl);
 }
 
+template<std::integral T>
+auto Executor<T>::LocalProgress() const -> T {
+    return std::visit([&](auto&& impl) {
+        return impl.LocalProgress();
+    },
+                      *fImpl);
+}
+
 template<std::integral T>
 auto Executor<T>::Executing() const -> bool {
     return std::visit([&](auto&& impl) {
@@ -139,6 +183,102 @@ auto Executor<T>::PrintProgressInterval(muc::chrono::seconds<double> t) -> void
                *fImpl);
 }
 
+template<std::integral T>
+auto Executor<T>::Profile() const -> bool {
+    return std::visit([&](auto&& impl) {
+        return impl.Profile();
+    },
+                      *fImpl);
+}
+
+template<std::integral T>
+auto Executor<T>::Profile(bool profile) -> void {
+    std::visit([&](auto&& impl) {
+        impl.Profile(profile);
+    },
+               *fImpl);
+}
+
+template<std::integral T>
+auto Executor<T>::Journal() const -> const std::filesystem::path& {
+    return std::visit([&](auto&& impl) -> const auto& {
+        return impl.Journal();
+    },
+                      *fImpl);
+}
+
+template<std::integral T>
+auto Executor<T>::Journal(std::filesystem::path path) -> void {
+    std::visit([&](auto&& impl) {
+        impl.Journal(std::move(path));
+    },
+               *fImpl);
+}
+
+template<std::integral T>
+auto Executor<T>::JournalInterval() const -> muc::chrono::seconds<double> {
+    return std::visit([&](auto&& impl) {
+        return impl.JournalInterval();
+    },
+                      *fImpl);
+}
+
+template<std::integral T>
+auto Executor<T>::JournalInterval(muc::chrono::seconds<double> t) -> void {
+    std::visit([&](auto&& impl) {
+        impl.JournalInterval(t);
+    },
+               *fImpl);
+}
+
+template<std::integral T>
+auto Executor<T>::PreTaskHook() const -> const std::function<auto(T)->void>& {
+    return std::visit([&](auto&& impl) -> const auto& {
+        return impl.PreTaskHook();
+    },
+                      *fImpl);
+}
+
+template<std::integral T>
+auto Executor<T>::PreTaskHook(std::function<auto(T)->void> hook) -> void {
+    std::visit([&](auto&& impl) {
+        impl.PreTaskHook(std::move(hook));
+    },
+               *fImpl);
+}
+
+template<std::integral T>
+auto Executor<T>::Lookahead() const -> int {
+    return std::visit([&](auto&& impl) {
+        return impl.Lookahead();
+    },
+                      *fImpl);
+}
+
+template<std::integral T>
+auto Executor<T>::Lookahead(int n) -> void {
+    std::visit([&](auto&& impl) {
+        impl.Lookahead(n);
+    },
+               *fImpl);
+}
+
+template<std::integral T>
+auto Executor<T>::LookaheadHook() const -> const std::function<auto(T)->void>& {
+    return std::visit([&](auto&& impl) -> const auto& {
+        return impl.LookaheadHook();
+    },
+                      *fImpl);
+}
+
+template<std::integral T>
+auto Executor<T>::LookaheadHook(std::function<auto(T)->void> hook) -> void {
+    std::visit([&](auto&& impl) {
+        impl.LookaheadHook(std::move(hook));
+    },
+               *fImpl);
+}
+
 template<std::integral T>
 auto Executor<T>::ExecutionName() const -> const std::string& {
     return std::visit([&](auto&& impl) -> const auto& {
@@ -173,15 +313,85 @@ auto Executor<T>::TaskName(std::string name) -> void {
 
 template<std::integral T>
 auto Executor<T>::operator()(struct Scheduler<T>::Task task, std::invocable<T> auto&& F) -> T {
+    Claim(*fImpl);
+    const auto release{gsl::finally([impl{fImpl.get()}] { Release(*impl); })};
+    return Run(*fImpl, std::move(task), std::forward<decltype(F)>(F));
+}
+
+template<std::integral T>
+auto Executor<T>::operator()(T size, std::invocable<T> auto&& F) -> T {
+    return (*this)({0, size}, std::forward<decltype(F)>(F));
+}
+
+template<std::integral T>
+auto Executor<T>::Launch(struct Scheduler<T>::Task task, std::invocable<T> auto&& F) -> AsyncExecution<T> {
+    // claimed in the caller, so that back-to-back launches cannot both pass the check
+    Claim(*fImpl);
+    // the loop holds the implementation, which stays in place if the executor is moved
+    const auto impl{fImpl.get()};
+    try {
+        return std::async(std::launch::async,
+                          [impl, task, F = std::decay_t<decltype(F)>{std::forward<decltype(F)>(F)}]() mutable {
+                              const auto release{gsl::finally([impl] { Release(*impl); })};
+                              return Run(*impl, task, F);
+                          });
+    } catch (...) {
+        Release(*impl);
+        throw;
+    }
+}
+
+template<std::integral T>
+auto Executor<T>::Launch(T size, std::invocable<T> auto&& F) -> AsyncExecution<T> {
+    return Launch({0, size}, std::forward<decltype(F)>(F));
+}
+
+template<std::integral T>
+template<typename A>
+auto Executor<T>::Reduce(struct Scheduler<T>::Task task, A init, std::invocable<T> auto&& Map, std::invocable<A, A> auto&& Combine) -> A {
+    if (not Journal().empty()) {
+        Throw<std::logic_error>("Reduce with a task journal, results of tasks completed in a previous run would be missing");
+    }
+    struct alignas(64) Partial {
+        A value;
+    };
+    std::vector<Partial> partial(NThread(), Partial{init});
+    (*this)(task, [&](T taskID) {
+        auto& value{partial[internal::WorkerID::This()].value};
+        value = std::invoke(Combine, std::move(value), static_cast<A>(std::invoke(Map, taskID)));
+    });
+    auto result{std::move(partial.front().value)};
+    for (auto&& [value] : partial | std::views::drop(1)) {
+        result = std::invoke(Combine, std::move(result), std::move(value));
+    }
     return std::visit([&](auto&& impl) {
-        return impl(std::move(task), std::forward<decltype(F)>(F));
+        return impl.CombineOverProcesses(std::move(result), Combine);
     },
                       *fImpl);
 }
 
 template<std::integral T>
-auto Executor<T>::operator()(T size, std::invocable<T> auto&& F) -> T {
-    return (*this)({0, size}, std::forward<decltype(F)>(F));
+template<typename A>
+auto Executor<T>::Reduce(T size, A init, std::invocable<T> auto&& Map, std::invocable<A, A> auto&& Combine) -> A {
+    return Reduce({0, size}, std::move(init), std::forward<decltype(Map)>(Map), std::forward<decltype(Combine)>(Combine));
+}
+
+template<std::integral T>
+auto Executor<T>::Claim(Impl& impl) -> void {
+    std::visit([](auto&& impl) { impl.ClaimExecution(); }, impl);
+}
+
+template<std::integral T>
+auto Executor<T>::Release(Impl& impl) -> void {
+    std::visit([](auto&& impl) { impl.ReleaseExecution(); }, impl);
+}
+
+template<std::integral T>
+auto Executor<T>::Run(Impl& impl, struct Scheduler<T>::Task task, std::invocable<T> auto&& F) -> T {
+    return std::visit([&](auto&& impl) {
+        return impl(std::move(task), std::forward<decltype(F)>(F));
+    },
+                      impl);
 }
 
 template<std::integral T>
@@ -200,4 +410,12 @@ auto Executor<T>::PrintExecutionSummary() const -> void {
                *fImpl);
 }
 
+template<std::integral T>
+auto Executor<T>::WriteExecutionInfo(const std::filesystem::path& path) const -> void {
+    std::visit([&](auto&& impl) {
+        impl.WriteExecutionInfo(path);
+    },
+               *fImpl);
+}
+
 } // namespace Mustard::inline Execution
@@ -0,0 +1,110 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/Execution/Scheduler.h++"
+#include "Mustard/Parallel/MPIDataType.h++"
+
+#include "mpi.h"
+
+#include "mplr/mplr.hpp"
+
+#include "gsl/gsl"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace Mustard::inline Execution {
+
+/// @brief Two-level scheduler built on one-sided atomics only.
+///
+/// Processes on a node claim batches from a node-local index counter in an
+/// MPI_Win_allocate_shared window with MPI_Fetch_and_op. The node-local index
+/// space is cut into large chunks, each mapped to a range of the task space
+/// fetched from a global counter on world rank 0. A chunk is fetched by the
+/// process whose batch contains its first index, right after claiming the
+/// batch, and published in the shared window for the others on the node.
+/// Chunks are fetched independently, so a chunk fetched after the global
+/// counter ran out is skipped rather than ending the loop; a process leaves
+/// the loop once the node-local index passes the last chunk. The node flags
+/// the global counter as exhausted in the shared window, after which chunks
+/// are skipped without global fetches, a whole chunk at a time. The shared
+/// window is allocated once per scheduler, with room for a bounded number of
+/// chunks. No process or thread serves requests.
+template<std::integral T>
+class HierarchicalSharedMemoryScheduler : public Scheduler<T> {
+public:
+    HierarchicalSharedMemoryScheduler();
+    ~HierarchicalSharedMemoryScheduler();
+
+    virtual auto PreLoopAction() -> void override;
+    virtual auto PreTaskAction() -> void override {}
+    virtual auto PostTaskAction() -> void override;
+    virtual auto PostLoopAction() -> void override;
+
+    virtual auto NExecutedTaskEstimation() const -> std::pair<bool, T> override;
+
+private:
+    auto Locate() -> bool;
+    auto Claim() -> void;
+    auto Refill(std::uint64_t chunk) -> void;
+    auto SkipChunk(std::uint64_t chunk) -> void;
+    auto ChunkOffset(std::uint64_t chunk) -> std::uint64_t;
+
+    auto NodeRead(MPI_Aint disp) -> std::uint64_t;
+    auto NodeWrite(MPI_Aint disp, std::uint64_t value) -> void;
+
+private:
+    mplr::communicator fComm;
+    mplr::communicator fNodeComm;
+    MPI_Win fGlobalWindow;
+    MPI_Win fNodeWindow;
+    std::uint64_t* fNodeTable;
+    std::uint64_t fMaxNChunk;
+    std::uint64_t fBatchSize;
+    std::uint64_t fChunkSize;
+    std::uint64_t fNChunk;
+    std::uint64_t fLocalIndex;
+    std::uint64_t fBatchEnd;
+    std::uint64_t fChunk;
+    std::uint64_t fChunkOffset;
+    bool fExhausted;
+
+    // node window layout: [node-local index counter, exhausted flag, chunk 0 offset + 1, chunk 1 offset + 1, ...],
+    // where 0 marks a chunk not fetched yet
+    static constexpr MPI_Aint fgCounterDisp{0};
+    static constexpr MPI_Aint fgExhaustedDisp{1};
+    static constexpr MPI_Aint fgChunkTableDisp{2};
+    static constexpr long double fgImbalancingFactor{1e-4};
+    static constexpr long double fgChunkFactor{1e-2};
+    static constexpr auto fgNoChunk{std::numeric_limits<std::uint64_t>::max()};
+    static constexpr std::chrono::microseconds fgMaxBackoff{100};
+};
+
+} // namespace Mustard::inline Execution
+
+#include "Mustard/Execution/HierarchicalSharedMemoryScheduler.inl"
@@ -0,0 +1,243 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::inline Execution {
+
+template<std::integral T>
+HierarchicalSharedMemoryScheduler<T>::HierarchicalSharedMemoryScheduler() :
+    Scheduler<T>{},
+    fComm{mplr::comm_world(), mplr::info{}},
+    fNodeComm{Env::MPIEnv::Instance().IntraNodeComm(), mplr::info{}},
+    fGlobalWindow{MPI_WIN_NULL},
+    fNodeWindow{MPI_WIN_NULL},
+    fNodeTable{},
+    fMaxNChunk{static_cast<std::uint64_t>(std::ceil(Env::MPIEnv::Instance().ClusterSize() / fgChunkFactor))},
+    fBatchSize{},
+    fChunkSize{},
+    fNChunk{},
+    fLocalIndex{},
+    fBatchEnd{},
+    fChunk{fgNoChunk},
+    fChunkOffset{},
+    fExhausted{} {
+    MPI_Info info;
+    MPI_Info_create(&info);
+    auto _{gsl::finally([&info] { MPI_Info_free(&info); })};
+    MPI_Info_set(info, "same_disp_unit", "true");
+    MPI_Info_set(info, "mpi_accumulate_granularity", std::to_string(sizeof(std::uint64_t)).c_str());
+    std::uint64_t* globalCounter;
+    MPI_Win_allocate(fComm.rank() == 0 ? sizeof(std::uint64_t) : 0, sizeof(std::uint64_t), info,
+                     fComm.native_handle(), &globalCounter, &fGlobalWindow);
+    // chunk table of the node, reused by all loops
+    const auto nodeWindowSize{fNodeComm.rank() == 0 ? fgChunkTableDisp + fMaxNChunk : 0};
+    MPI_Win_allocate_shared(nodeWindowSize * sizeof(std::uint64_t), sizeof(std::uint64_t), info,
+                            fNodeComm.native_handle(), &fNodeTable, &fNodeWindow);
+}
+
+template<std::integral T>
+HierarchicalSharedMemoryScheduler<T>::~HierarchicalSharedMemoryScheduler() {
+    if (fNodeWindow != MPI_WIN_NULL) {
+        MPI_Win_free(&fNodeWindow);
+    }
+    if (fGlobalWindow != MPI_WIN_NULL) {
+        MPI_Win_free(&fGlobalWindow);
+    }
+}
+
+template<std::integral T>
+auto HierarchicalSharedMemoryScheduler<T>::PreLoopAction() -> void {
+    const auto nTask{static_cast<std::uint64_t>(this->NTask())};
+    fBatchSize = std::max(1ll, std::llround(fgImbalancingFactor * this->NTask() / fComm.size()));
+    // no more than fMaxNChunk chunks, the chunk table is allocated once
+    fChunkSize = std::max<std::uint64_t>({fBatchSize,
+                                          static_cast<std::uint64_t>(std::llround(fgChunkFactor * this->NTask() / Env::MPIEnv::Instance().ClusterSize())),
+                                          (nTask + fMaxNChunk - 1) / fMaxNChunk});
+    // a node never gets more chunks than there are in total
+    fNChunk = (nTask + fChunkSize - 1) / fChunkSize;
+    fLocalIndex = 0;
+    fBatchEnd = 0;
+    fChunk = fgNoChunk;
+    fChunkOffset = 0;
+    fExhausted = false;
+
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, fNodeWindow);
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, fGlobalWindow);
+    if (fNodeComm.rank() == 0) {
+        std::fill_n(fNodeTable, fgChunkTableDisp + fNChunk, 0);
+        MPI_Win_sync(fNodeWindow);
+    }
+    if (fComm.rank() == 0) {
+        const std::uint64_t zero{};
+        MPI_Accumulate(&zero, 1, Parallel::MPIDataType<std::uint64_t>(), 0, 0,
+                       1, Parallel::MPIDataType<std::uint64_t>(), MPI_REPLACE, fGlobalWindow);
+        MPI_Win_flush(0, fGlobalWindow);
+    }
+    fComm.ibarrier().wait(mplr::duty_ratio::preset::moderate);
+    MPI_Win_sync(fNodeWindow);
+
+    if (not Locate()) {
+        this->fExecutingTask = this->fTask.last;
+    }
+}
+
+template<std::integral T>
+auto HierarchicalSharedMemoryScheduler<T>::PostTaskAction() -> void {
+    if (++fLocalIndex != fBatchEnd and fLocalIndex % fChunkSize != 0 and
+        this->fExecutingTask + 1 != this->fTask.last) [[likely]] {
+        // still in the batch, the chunk and the task range
+        ++this->fExecutingTask;
+        return;
+    }
+    if (not Locate()) {
+        this->fExecutingTask = this->fTask.last;
+    }
+}
+
+template<std::integral T>
+auto HierarchicalSharedMemoryScheduler<T>::PostLoopAction() -> void {
+    MPI_Win_unlock_all(fGlobalWindow);
+    MPI_Win_unlock_all(fNodeWindow);
+    // the node is done with the chunk table before the next loop resets it
+    fNodeComm.ibarrier().wait(mplr::duty_ratio::preset::moderate);
+}
+
+template<std::integral T>
+auto HierarchicalSharedMemoryScheduler<T>::NExecutedTaskEstimation() const -> std::pair<bool, T> {
+    return {this->fNLocalExecutedTask > 10 * static_cast<T>(fBatchSize),
+            std::min(static_cast<T>(this->fNLocalExecutedTask * fComm.size()), this->NTask())};
+}
+
+template<std::integral T>
+auto HierarchicalSharedMemoryScheduler<T>::Locate() -> bool {
+    while (true) {
+        const auto claim{fLocalIndex == fBatchEnd};
+        if (claim) {
+            Claim();
+        }
+        const auto chunk{fLocalIndex / fChunkSize};
+        if (chunk >= fNChunk) {
+            return false;
+        }
+        if (chunk != fChunk) {
+            fChunk = chunk;
+            fChunkOffset = ChunkOffset(chunk);
+        }
+        if (const auto offset{fChunkOffset + fLocalIndex % fChunkSize};
+            offset < static_cast<std::uint64_t>(this->NTask())) {
+            this->fExecutingTask = static_cast<T>(this->fTask.first + offset);
+            if (claim) {
+                this->RecordBatchSize(static_cast<T>(fBatchSize));
+            }
+            return true;
+        }
+        // rest of the chunk is beyond the task range, later chunks may have been fetched earlier
+        SkipChunk(chunk);
+    }
+}
+
+template<std::integral T>
+auto HierarchicalSharedMemoryScheduler<T>::Claim() -> void {
+    MPI_Fetch_and_op(&fBatchSize, &fLocalIndex, Parallel::MPIDataType<std::uint64_t>(),
+                     0, fgCounterDisp, MPI_SUM, fNodeWindow);
+    MPI_Win_flush(0, fNodeWindow);
+    this->CountMessage();
+    fBatchEnd = fLocalIndex + fBatchSize;
+    // refill now rather than when reaching the chunk, others on the node may be waiting for it
+    for (auto chunk{(fLocalIndex + fChunkSize - 1) / fChunkSize};
+         chunk * fChunkSize < fBatchEnd and chunk < fNChunk; ++chunk) {
+        Refill(chunk);
+    }
+}
+
+template<std::integral T>
+auto HierarchicalSharedMemoryScheduler<T>::Refill(std::uint64_t chunk) -> void {
+    const auto nTask{static_cast<std::uint64_t>(this->NTask())};
+    // once the global counter has run out on this node, chunks are marked beyond the task range
+    // without fetching
+    if (not fExhausted) {
+        fExhausted = NodeRead(fgExhaustedDisp) != 0;
+    }
+    if (fExhausted) {
+        NodeWrite(fgChunkTableDisp + chunk, nTask + 1);
+        return;
+    }
+    std::uint64_t offset;
+    MPI_Fetch_and_op(&fChunkSize, &offset, Parallel::MPIDataType<std::uint64_t>(),
+                     0, 0, MPI_SUM, fGlobalWindow);
+    MPI_Win_flush(0, fGlobalWindow);
+    this->CountMessage();
+    NodeWrite(fgChunkTableDisp + chunk, offset + 1);
+    if (offset + fChunkSize >= nTask) {
+        fExhausted = true;
+        NodeWrite(fgExhaustedDisp, 1);
+    }
+}
+
+template<std::integral T>
+auto HierarchicalSharedMemoryScheduler<T>::SkipChunk(std::uint64_t chunk) -> void {
+    const auto next{(chunk + 1) * fChunkSize};
+    if (next <= fBatchEnd) {
+        fLocalIndex = next;
+        return;
+    }
+    // claim the rest of the chunk at once, by moving the node-local index counter to the next chunk
+    auto expected{NodeRead(fgCounterDisp)};
+    while (expected < next) {
+        std::uint64_t actual;
+        MPI_Compare_and_swap(&next, &expected, &actual, Parallel::MPIDataType<std::uint64_t>(),
+                             0, fgCounterDisp, fNodeWindow);
+        MPI_Win_flush(0, fNodeWindow);
+        this->CountMessage();
+        if (actual == expected) {
+            break;
+        }
+        expected = actual;
+    }
+    // the next batch is claimed from the counter, which is now at or past the next chunk
+    fLocalIndex = fBatchEnd;
+}
+
+template<std::integral T>
+auto HierarchicalSharedMemoryScheduler<T>::ChunkOffset(std::uint64_t chunk) -> std::uint64_t {
+    // the refilling process has claimed the chunk head and is fetching it, back off while waiting
+    for (std::chrono::nanoseconds backoff{100};; backoff = std::min<std::chrono::nanoseconds>(2 * backoff, fgMaxBackoff)) {
+        if (const auto entry{NodeRead(fgChunkTableDisp + chunk)}; entry != 0) {
+            return entry - 1;
+        }
+        std::this_thread::sleep_for(backoff);
+    }
+}
+
+template<std::integral T>
+auto HierarchicalSharedMemoryScheduler<T>::NodeRead(MPI_Aint disp) -> std::uint64_t {
+    std::uint64_t result;
+    MPI_Fetch_and_op(nullptr, &result, Parallel::MPIDataType<std::uint64_t>(), 0, disp, MPI_NO_OP, fNodeWindow);
+    MPI_Win_flush(0, fNodeWindow);
+    this->CountMessage();
+    return result;
+}
+
+template<std::integral T>
+auto HierarchicalSharedMemoryScheduler<T>::NodeWrite(MPI_Aint disp, std::uint64_t value) -> void {
+    MPI_Accumulate(&value, 1, Parallel::MPIDataType<std::uint64_t>(), 0, disp,
+                   1, Parallel::MPIDataType<std::uint64_t>(), MPI_REPLACE, fNodeWindow);
+    MPI_Win_flush(0, fNodeWindow);
+    this->CountMessage();
+}
+
+} // namespace Mustard::inline Execution
@@ -24,6 +24,7 @@
 #include "mplr/mplr.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <concepts>
 #include <cstddef>
@@ -49,8 +50,9 @@ private:
 
     private:
         MasterWorkerScheduler<T>* fS;
+        std::vector<double> fTaskTimeRecv;
         mplr::prequest_pool fRecv;
-        std::vector<T> fTaskIDSend;
+        std::vector<std::pair<T, T>> fBatchSend;
         mplr::prequest_pool fSend;
     };
 
@@ -66,14 +68,17 @@ public:
 
 private:
     mplr::communicator fComm;
-    T fBatchSize;
+    T fFixedBatchSize;
     std::unique_ptr<Master> fMaster;
     std::jthread fMasterThread;
 
+    double fTaskTimeSend;
     mplr::prequest fSend;
-    T fTaskIDRecv;
+    std::pair<T, T> fBatchRecv;
     mplr::prequest fRecv;
+    T fBatchSize;
     T fTaskCounter;
+    std::chrono::steady_clock::time_point fBatchBeginTime;
 
     static constexpr long double fgImbalancingFactor{1e-3};
 };
@@ -21,16 +21,18 @@ namespace Mustard::inline Execution {
 template<std::integral T>
 MasterWorkerScheduler<T>::Master::Master(MasterWorkerScheduler<T>* s) :
     fS{s},
+    fTaskTimeRecv{},
     fRecv{},
-    fTaskIDSend{},
+    fBatchSend{},
     fSend{} {
     const auto commSize{fS->fComm.size()};
+    fTaskTimeRecv.reserve(commSize);
     for (int src{}; src < commSize; ++src) {
-        fRecv.push(fS->fComm.recv_init(src));
+        fRecv.push(fS->fComm.recv_init(fTaskTimeRecv.emplace_back(), src));
     }
-    fTaskIDSend.reserve(commSize);
+    fBatchSend.reserve(commSize);
     for (int dest{}; dest < commSize; ++dest) {
-        fSend.push(fS->fComm.rsend_init(fTaskIDSend.emplace_back(), dest));
+        fSend.push(fS->fComm.rsend_init(fBatchSend.emplace_back(), dest));
     }
 }
 
@@ -41,19 +43,26 @@ auto MasterWorkerScheduler<T>::Master::StartAll() -> void {
 
 template<std::integral T>
 auto MasterWorkerScheduler<T>::Master::operator()() -> void {
-    T mainTaskID{fS->fTask.first + fS->fComm.size() * fS->fBatchSize};
+    const auto commSize{fS->fComm.size()};
+    const auto taskLast{fS->fTask.last};
+    T mainTaskID{fS->fTask.first + fS->InitialBatch(commSize, commSize, fS->fFixedBatchSize).first};
     while (true) {
         const auto [result, recvRank]{fRecv.waitsome(mplr::duty_ratio::preset::active)};
         if (result == mplr::test_result::no_active_requests) {
             break;
         }
         for (auto&& rank : recvRank) {
-            fTaskIDSend[rank] = std::min(mainTaskID, fS->fTask.last);
-            if (fTaskIDSend[rank] != fS->fTask.last) [[likely]] {
-                mainTaskID += fS->fBatchSize;
+            fS->UpdateTaskTime(std::chrono::duration<double>{fTaskTimeRecv[rank]});
+            const auto nRemaining{taskLast - std::min(mainTaskID, taskLast)};
+            const auto batchSize{fS->NextBatchSize(nRemaining, commSize, fS->fFixedBatchSize)};
+            fSend.wait(rank);
+            auto& [first, last]{fBatchSend[rank]};
+            first = std::min(mainTaskID, taskLast);
+            last = std::min<T>(mainTaskID + batchSize, taskLast);
+            if (first != taskLast) [[likely]] {
+                mainTaskID += batchSize;
                 fRecv.start(rank);
             }
-            fSend.wait(rank);
             fSend.start(rank);
         }
     }
@@ -64,13 +73,16 @@ template<std::integral T>
 MasterWorkerScheduler<T>::MasterWorkerScheduler() :
     Scheduler<T>{},
     fComm{},
-    fBatchSize{},
+    fFixedBatchSize{},
     fMaster{},
     fMasterThread{},
+    fTaskTimeSend{},
     fSend{},
-    fTaskIDRecv{},
+    fBatchRecv{},
     fRecv{},
-    fTaskCounter{} {
+    fBatchSize{},
+    fTaskCounter{},
+    fBatchBeginTime{} {
     mplr::info commInfo;
     commInfo.set("mpi_assert_no_any_tag", "true");
     commInfo.set("mpi_assert_no_any_source", "true");
@@ -80,15 +92,20 @@ MasterWorkerScheduler<T>::MasterWorkerScheduler() :
     if (fComm.rank() == 0) {
         fMaster = std::make_unique<Master>(this);
     }
-    fSend = fComm.rsend_init(0);
-    fRecv = fComm.recv_init(fTaskIDRecv, 0);
+    fSend = fComm.rsend_init(fTaskTimeSend, 0);
+    fRecv = fComm.recv_init(fBatchRecv, 0);
 }
 
 template<std::integral T>
 auto MasterWorkerScheduler<T>::PreLoopAction() -> void {
-    fBatchSize = std::max(1ll, std::llround(fgImbalancingFactor * this->NTask() / fComm.size()));
-    this->fExecutingTask = this->fTask.first + fComm.rank() * fBatchSize;
+    fFixedBatchSize = std::max(1ll, std::llround(fgImbalancingFactor * this->NTask() / fComm.size()));
+    const auto [offset, batchSize]{this->InitialBatch(fComm.rank(), fComm.size(), fFixedBatchSize)};
+    this->fExecutingTask = this->fTask.first + offset;
+    fBatchSize = batchSize;
     fTaskCounter = 0;
+    fTaskTimeSend = 0;
+    fBatchBeginTime = std::chrono::steady_clock::now();
+    this->RecordBatchSize(fBatchSize);
 
     if (fMaster) {
         fMaster->StartAll();
@@ -102,6 +119,7 @@ auto MasterWorkerScheduler<T>::PreTaskAction() -> void {
     if (fTaskCounter == 0) {
         fRecv.start();
         fSend.start();
+        this->CountMessage(2);
     }
 }
 
@@ -110,7 +128,16 @@ auto MasterWorkerScheduler<T>::PostTaskAction() -> void {
     if (++fTaskCounter == fBatchSize) {
         fSend.wait();
         fRecv.wait();
-        this->fExecutingTask = fTaskIDRecv;
+        // reported to the master along with the next request
+        const auto now{std::chrono::steady_clock::now()};
+        fTaskTimeSend = std::chrono::duration<double>{now - fBatchBeginTime}.count() / fBatchSize;
+        fBatchBeginTime = now;
+        const auto& [first, last]{fBatchRecv};
+        this->fExecutingTask = first;
+        fBatchSize = last - first;
+        if (fBatchSize != 0) {
+            this->RecordBatchSize(fBatchSize);
+        }
         fTaskCounter = 0;
     } else {
         ++this->fExecutingTask;
@@ -129,7 +156,7 @@ auto MasterWorkerScheduler<T>::PostLoopAction() -> void {
 
 template<std::integral T>
 auto MasterWorkerScheduler<T>::NExecutedTaskEstimation() const -> std::pair<bool, T> {
-    return {this->fNLocalExecutedTask > 10 * fBatchSize,
+    return {this->fNLocalExecutedTask > 10 * fFixedBatchSize,
             this->fExecutingTask - this->fTask.first};
 }
 
@@ -21,11 +21,30 @@
 #include "Mustard/Parallel/MPIPredefined.h++"
 #include "Mustard/Utility/NonCopyableBase.h++"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <concepts>
 #include <utility>
+#include <vector>
 
 namespace Mustard::inline Execution {
 
+/// @brief Batch sizing policy of dynamic schedulers.
+///
+/// Fixed: constant batch size derived from the number of tasks.
+/// Guided: batch size is the remaining tasks divided by the number of workers.
+/// Factoring: batch size is half of the guided one, i.e. half of the remaining
+/// work is handed out per round.
+/// Adaptive policies never go below the batch size that keeps a batch running
+/// for a minimum wall time, based on the measured time per task.
+/// Honored by MasterWorkerScheduler and SharedMemoryScheduler.
+enum struct BatchPolicy {
+    Fixed,
+    Guided,
+    Factoring
+};
+
 template<std::integral T>
     requires(Parallel::MPIPredefined<T> and sizeof(T) >= sizeof(short))
 class Scheduler : public NonCopyableBase {
@@ -36,14 +55,20 @@ public:
     };
 
 public:
+    Scheduler();
     virtual ~Scheduler() = default;
 
     auto Task() const -> auto { return fTask; }
     auto NTask() const -> auto { return fTask.last - fTask.first; }
     auto ExecutingTask() const -> auto { return fExecutingTask; }
     auto NLocalExecutedTask() const -> auto { return fNLocalExecutedTask; }
+    auto BatchPolicy() const -> auto { return fBatchPolicy; }
+    auto BatchSizeTrace() const -> const auto& { return fBatchSizeTrace; }
+    /// @brief Number of point-to-point messages and RMA operations issued by this process.
+    auto NMessage() const -> auto { return fNMessage; }
 
     auto Task(struct Task task) -> void { fTask = task; }
+    auto BatchPolicy(enum BatchPolicy policy) -> void { fBatchPolicy = policy; }
     auto Reset() -> void;
     auto IncrementNLocalExecutedTask() -> void { ++fNLocalExecutedTask; }
 
@@ -54,10 +79,24 @@ public:
 
     virtual auto NExecutedTaskEstimation() const -> std::pair<bool, T> = 0;
 
+protected:
+    auto InitialBatch(int rank, int nWorker, T fixedBatchSize) const -> std::pair<T, T>;
+    auto NextBatchSize(T nRemaining, int nWorker, T fixedBatchSize) const -> T;
+    auto UpdateTaskTime(std::chrono::duration<double> taskTime) -> void;
+    auto RecordBatchSize(T size) -> void { fBatchSizeTrace.push_back(size); }
+    auto CountMessage(unsigned long long n = 1) -> void { fNMessage += n; }
+
 protected:
     struct Task fTask;
     T fExecutingTask;
     T fNLocalExecutedTask;
+
+    enum BatchPolicy fBatchPolicy;
+    std::chrono::duration<double> fTaskTime;
+    std::vector<T> fBatchSizeTrace;
+    unsigned long long fNMessage;
+
+    static constexpr std::chrono::duration<double> fgMinBatchTime{0.01};
 };
 
 } // namespace Mustard::inline Execution
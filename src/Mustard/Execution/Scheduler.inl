@@ -18,11 +18,74 @@
 
 namespace Mustard::inline Execution {
 
+template<std::integral T>
+    requires(Parallel::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+Scheduler<T>::Scheduler() :
+    NonCopyableBase{},
+    fTask{},
+    fExecutingTask{},
+    fNLocalExecutedTask{},
+    fBatchPolicy{Execution::BatchPolicy::Fixed},
+    fTaskTime{},
+    fBatchSizeTrace{},
+    fNMessage{} {}
+
 template<std::integral T>
     requires(Parallel::MPIPredefined<T> and sizeof(T) >= sizeof(short))
 auto Scheduler<T>::Reset() -> void {
     fExecutingTask = fTask.first;
     fNLocalExecutedTask = 0;
+    fTaskTime = {};
+    fBatchSizeTrace.clear();
+    fNMessage = 0;
+}
+
+template<std::integral T>
+    requires(Parallel::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto Scheduler<T>::InitialBatch(int rank, int nWorker, T fixedBatchSize) const -> std::pair<T, T> {
+    if (fBatchPolicy == Execution::BatchPolicy::Fixed) {
+        return {static_cast<T>(rank * fixedBatchSize), fixedBatchSize};
+    }
+    // replay the batches handed out to lower ranks, identical on every rank
+    T offset{};
+    auto batchSize{NextBatchSize(NTask(), nWorker, fixedBatchSize)};
+    for (int i{}; i < rank; ++i) {
+        offset += batchSize;
+        batchSize = NextBatchSize(NTask() - offset, nWorker, fixedBatchSize);
+    }
+    return {offset, batchSize};
+}
+
+template<std::integral T>
+    requires(Parallel::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto Scheduler<T>::NextBatchSize(T nRemaining, int nWorker, T fixedBatchSize) const -> T {
+    using enum Execution::BatchPolicy;
+    const auto n{static_cast<long long>(nRemaining)};
+    long long batchSize{};
+    switch (fBatchPolicy) {
+    case Fixed:
+        return fixedBatchSize;
+    case Guided:
+        batchSize = (n + nWorker - 1) / nWorker;
+        break;
+    case Factoring:
+        batchSize = (n + 2 * nWorker - 1) / (2 * nWorker);
+        break;
+    }
+    if (fTaskTime.count() > 0) {
+        batchSize = std::max(batchSize, std::llround(std::ceil(fgMinBatchTime / fTaskTime)));
+    }
+    return static_cast<T>(std::clamp(batchSize, 1ll, std::max(n, 1ll)));
+}
+
+template<std::integral T>
+    requires(Parallel::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto Scheduler<T>::UpdateTaskTime(std::chrono::duration<double> taskTime) -> void {
+    if (taskTime.count() <= 0) {
+        return;
+    }
+    // exponential moving average, follows drifts in task cost
+    fTaskTime = fTaskTime.count() > 0 ? fTaskTime + 0.25 * (taskTime - fTaskTime) : taskTime;
 }
 
 } // namespace Mustard::inline Execution
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include "Mustard/Env/MPIEnv.h++"
 #include "Mustard/Execution/Scheduler.h++"
 #include "Mustard/IO/PrettyLog.h++"
 #include "Mustard/Parallel/MPIDataType.h++"
@@ -27,6 +28,7 @@
 #include "gsl/gsl"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <concepts>
 #include <stdexcept>
@@ -51,8 +53,10 @@ public:
 private:
     volatile T* fMainTaskID;
     MPI_Win fMainTaskIDWindow;
+    T fFixedBatchSize;
     T fBatchSize;
     T fTaskCounter;
+    std::chrono::steady_clock::time_point fBatchBeginTime;
 
     static constexpr long double fgImbalancingFactor{1e-4};
 };
@@ -23,8 +23,10 @@ SharedMemoryScheduler<T>::SharedMemoryScheduler() :
     Scheduler<T>{},
     fMainTaskID{},
     fMainTaskIDWindow{MPI_WIN_NULL},
+    fFixedBatchSize{},
     fBatchSize{},
-    fTaskCounter{} {
+    fTaskCounter{},
+    fBatchBeginTime{} {
     const auto& mpiEnv{Env::MPIEnv::Instance()};
     if (mpiEnv.OnCluster()) {
         Throw<std::runtime_error>("World communicator involves multiple shared memory domains");
@@ -33,7 +35,7 @@ SharedMemoryScheduler<T>::SharedMemoryScheduler() :
     MPI_Info info;
     MPI_Info_create(&info);
     auto _{gsl::finally([&info] { MPI_Info_free(&info); })};
-    MPI_Info_set(info, "accumulate_ops", "same_op");
+    MPI_Info_set(info, "accumulate_ops", "same_op_no_op");
     MPI_Info_set(info, "mpi_accumulate_granularity", std::to_string(sizeof(T)).c_str());
     MPI_Info_set(info, "same_disp_unit", "true");
     const auto& intraNodeComm{mpiEnv.IntraNodeComm()};
@@ -53,13 +55,17 @@ SharedMemoryScheduler<T>::~SharedMemoryScheduler() {
 template<std::integral T>
 auto SharedMemoryScheduler<T>::PreLoopAction() -> void {
     const auto& intraNodeComm{Env::MPIEnv::Instance().IntraNodeComm()};
-    fBatchSize = std::max(1ll, std::llround(fgImbalancingFactor * this->NTask() / intraNodeComm.size()));
-    this->fExecutingTask = this->fTask.first + intraNodeComm.rank() * fBatchSize;
+    fFixedBatchSize = std::max(1ll, std::llround(fgImbalancingFactor * this->NTask() / intraNodeComm.size()));
+    const auto [offset, batchSize]{this->InitialBatch(intraNodeComm.rank(), intraNodeComm.size(), fFixedBatchSize)};
+    this->fExecutingTask = this->fTask.first + offset;
+    fBatchSize = batchSize;
     fTaskCounter = 0;
+    fBatchBeginTime = std::chrono::steady_clock::now();
+    this->RecordBatchSize(fBatchSize);
 
     if (fMainTaskID) {
         MPI_Win_lock(MPI_LOCK_EXCLUSIVE, 0, 0, fMainTaskIDWindow);
-        *fMainTaskID = this->fTask.first + intraNodeComm.size() * fBatchSize;
+        *fMainTaskID = this->fTask.first + this->InitialBatch(intraNodeComm.size(), intraNodeComm.size(), fFixedBatchSize).first;
         MPI_Win_unlock(0, fMainTaskIDWindow);
     }
 }
@@ -67,10 +73,26 @@ auto SharedMemoryScheduler<T>::PreLoopAction() -> void {
 template<std::integral T>
 auto SharedMemoryScheduler<T>::PostTaskAction() -> void {
     if (++fTaskCounter == fBatchSize) {
+        const auto now{std::chrono::steady_clock::now()};
+        this->UpdateTaskTime(std::chrono::duration<double>{now - fBatchBeginTime} / fBatchSize);
+        fBatchBeginTime = now;
         MPI_Win_lock(MPI_LOCK_SHARED, 0, 0, fMainTaskIDWindow);
+        if (this->BatchPolicy() != Execution::BatchPolicy::Fixed) {
+            // size the batch from the tasks not yet handed out to any process
+            T mainTaskID;
+            MPI_Fetch_and_op(nullptr, &mainTaskID, Parallel::MPIDataType<T>(), 0, 0, MPI_NO_OP, fMainTaskIDWindow);
+            MPI_Win_flush(0, fMainTaskIDWindow);
+            this->CountMessage();
+            const auto nRemaining{this->fTask.last - std::min(mainTaskID, this->fTask.last)};
+            fBatchSize = this->NextBatchSize(nRemaining, Env::MPIEnv::Instance().IntraNodeComm().size(), fFixedBatchSize);
+        }
         MPI_Fetch_and_op(&fBatchSize, &this->fExecutingTask, Parallel::MPIDataType<T>(), 0, 0, MPI_SUM, fMainTaskIDWindow);
         MPI_Win_unlock(0, fMainTaskIDWindow);
+        this->CountMessage();
         this->fExecutingTask = std::min(this->fExecutingTask, this->fTask.last);
+        if (this->fExecutingTask != this->fTask.last) {
+            this->RecordBatchSize(std::min<T>(fBatchSize, this->fTask.last - this->fExecutingTask));
+        }
         fTaskCounter = 0;
     } else {
         ++this->fExecutingTask;
@@ -79,7 +101,7 @@ auto SharedMemoryScheduler<T>::PostTaskAction() -> void {
 
 template<std::integral T>
 auto SharedMemoryScheduler<T>::NExecutedTaskEstimation() const -> std::pair<bool, T> {
-    return {this->fNLocalExecutedTask > 10 * fBatchSize,
+    return {this->fNLocalExecutedTask > 10 * fFixedBatchSize,
             this->fExecutingTask - this->fTask.first};
 }
 
@@ -0,0 +1,104 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Execution/Scheduler.h++"
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/Math/Random/Distribution/Uniform.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro256PlusPlus.h++"
+#include "Mustard/Parallel/MPIDataType.h++"
+
+#include "mpi.h"
+
+#include "mplr/mplr.hpp"
+
+#include "gsl/gsl"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace Mustard::inline Execution {
+
+/// @brief Decentralized scheduler based on one-sided work stealing.
+///
+/// Each process owns a contiguous chunk of the task range, published in an
+/// MPI window as a (begin, end) offset pair packed into one 64-bit word.
+/// The owner claims batches from the front with MPI_Fetch_and_op, and an idle
+/// process steals the back half of a random victim's chunk with
+/// MPI_Compare_and_swap. No process or thread serves requests.
+/// A process leaves the loop once a full sweep finds no work to steal.
+template<std::integral T>
+class WorkStealingScheduler : public Scheduler<T> {
+public:
+    WorkStealingScheduler();
+    ~WorkStealingScheduler();
+
+    virtual auto PreLoopAction() -> void override;
+    virtual auto PreTaskAction() -> void override {}
+    virtual auto PostTaskAction() -> void override;
+    virtual auto PostLoopAction() -> void override;
+
+    virtual auto NExecutedTaskEstimation() const -> std::pair<bool, T> override;
+
+private:
+    struct TaskRange {
+        T first;
+        T last;
+    };
+
+private:
+    auto ClaimLocal() -> bool;
+    auto Steal() -> bool;
+    auto TryStealFrom(int victim) -> std::optional<TaskRange>;
+    auto Install(TaskRange range) -> bool;
+
+    auto AtomicRead(int rank, MPI_Aint disp) -> std::uint64_t;
+    auto AtomicWrite(int rank, MPI_Aint disp, std::uint64_t value) -> void;
+
+    static constexpr auto Pack(std::uint64_t begin, std::uint64_t end) -> std::uint64_t { return begin << 32 | end; }
+    static constexpr auto Begin(std::uint64_t packed) -> std::uint64_t { return packed >> 32; }
+    static constexpr auto End(std::uint64_t packed) -> std::uint64_t { return packed & 0xFFFFFFFFull; }
+
+private:
+    mplr::communicator fComm;
+    MPI_Win fWindow;
+    std::int64_t fBase;
+    T fBatchSize;
+    T fBatchEnd;
+    Math::Random::Xoshiro256PlusPlus fRandom;
+
+    // window layout: [packed (begin, end) offsets, base]
+    static constexpr MPI_Aint fgRangeDisp{0};
+    static constexpr MPI_Aint fgBaseDisp{1};
+    static constexpr long double fgImbalancingFactor{1e-3};
+    static constexpr std::uint64_t fgMaxOffset{0xFFFFFFFFull};
+};
+
+} // namespace Mustard::inline Execution
+
+#include "Mustard/Execution/WorkStealingScheduler.inl"
@@ -0,0 +1,202 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::inline Execution {
+
+template<std::integral T>
+WorkStealingScheduler<T>::WorkStealingScheduler() :
+    Scheduler<T>{},
+    fComm{mplr::comm_world(), mplr::info{}},
+    fWindow{MPI_WIN_NULL},
+    fBase{},
+    fBatchSize{},
+    fBatchEnd{},
+    fRandom{static_cast<std::uint64_t>(fComm.rank())} {
+    MPI_Info info;
+    MPI_Info_create(&info);
+    auto _{gsl::finally([&info] { MPI_Info_free(&info); })};
+    MPI_Info_set(info, "same_disp_unit", "true");
+    MPI_Info_set(info, "mpi_accumulate_granularity", std::to_string(sizeof(std::uint64_t)).c_str());
+    std::uint64_t* window;
+    MPI_Win_allocate(2 * sizeof(std::uint64_t), sizeof(std::uint64_t), info,
+                     fComm.native_handle(), &window, &fWindow);
+}
+
+template<std::integral T>
+WorkStealingScheduler<T>::~WorkStealingScheduler() {
+    if (fWindow != MPI_WIN_NULL) {
+        MPI_Win_free(&fWindow);
+    }
+}
+
+template<std::integral T>
+auto WorkStealingScheduler<T>::PreLoopAction() -> void {
+    const auto commSize{static_cast<T>(fComm.size())};
+    const auto rank{static_cast<T>(fComm.rank())};
+    fBatchSize = std::max(1ll, std::llround(fgImbalancingFactor * this->NTask() / commSize));
+    // initial contiguous partition
+    const auto quotient{static_cast<T>(this->NTask() / commSize)};
+    const auto remainder{static_cast<T>(this->NTask() % commSize)};
+    const auto length{static_cast<std::uint64_t>(quotient + (rank < remainder))};
+    if (length >= fgMaxOffset) {
+        Throw<std::runtime_error>(fmt::format("Too many tasks per process ({}) for work stealing", length));
+    }
+    fBase = static_cast<std::int64_t>(this->fTask.first) + rank * quotient + std::min(rank, remainder);
+
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, fWindow);
+    AtomicWrite(fComm.rank(), fgBaseDisp, std::bit_cast<std::uint64_t>(fBase));
+    AtomicWrite(fComm.rank(), fgRangeDisp, Pack(0, length));
+    fComm.ibarrier().wait(mplr::duty_ratio::preset::moderate);
+
+    if (not ClaimLocal() and not Steal()) {
+        this->fExecutingTask = this->fTask.last;
+    }
+}
+
+template<std::integral T>
+auto WorkStealingScheduler<T>::PostTaskAction() -> void {
+    if (++this->fExecutingTask != fBatchEnd) [[likely]] {
+        return;
+    }
+    if (not ClaimLocal() and not Steal()) {
+        this->fExecutingTask = this->fTask.last;
+    }
+}
+
+template<std::integral T>
+auto WorkStealingScheduler<T>::PostLoopAction() -> void {
+    MPI_Win_unlock_all(fWindow);
+}
+
+template<std::integral T>
+auto WorkStealingScheduler<T>::NExecutedTaskEstimation() const -> std::pair<bool, T> {
+    return {this->fNLocalExecutedTask > 10 * fBatchSize,
+            std::min(static_cast<T>(this->fNLocalExecutedTask * fComm.size()), this->NTask())};
+}
+
+template<std::integral T>
+auto WorkStealingScheduler<T>::ClaimLocal() -> bool {
+    const auto increment{Pack(fBatchSize, 0)};
+    std::uint64_t previous;
+    MPI_Fetch_and_op(&increment, &previous, Parallel::MPIDataType<std::uint64_t>(),
+                     fComm.rank(), fgRangeDisp, MPI_SUM, fWindow);
+    MPI_Win_flush(fComm.rank(), fWindow);
+    this->CountMessage();
+    const auto begin{Begin(previous)};
+    const auto end{End(previous)};
+    if (begin >= end) {
+        return false;
+    }
+    this->fExecutingTask = static_cast<T>(fBase + begin);
+    fBatchEnd = static_cast<T>(fBase + std::min<std::uint64_t>(begin + fBatchSize, end));
+    return true;
+}
+
+template<std::integral T>
+auto WorkStealingScheduler<T>::Steal() -> bool {
+    const auto commSize{fComm.size()};
+    const auto rank{fComm.rank()};
+    if (commSize == 1) {
+        return false;
+    }
+    // random victims first, then a full sweep before giving up
+    Math::Random::Uniform<int> uniform{0, commSize - 2};
+    for (int i{}; i < commSize; ++i) {
+        auto victim{uniform(fRandom)};
+        victim += victim >= rank;
+        if (const auto range{TryStealFrom(victim)}) {
+            if (Install(*range)) {
+                return true;
+            }
+        }
+    }
+    for (int i{1}; i < commSize; ++i) {
+        while (const auto range{TryStealFrom((rank + i) % commSize)}) {
+            if (Install(*range)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+template<std::integral T>
+auto WorkStealingScheduler<T>::TryStealFrom(int victim) -> std::optional<TaskRange> {
+    while (true) {
+        const auto packed{AtomicRead(victim, fgRangeDisp)};
+        const auto begin{Begin(packed)};
+        const auto end{End(packed)};
+        if (begin >= end) {
+            return std::nullopt;
+        }
+        // base is consistent with packed if the CAS below succeeds, since
+        // packed values never repeat (see Install)
+        const auto base{std::bit_cast<std::int64_t>(AtomicRead(victim, fgBaseDisp))};
+        const auto middle{begin + (end - begin) / 2};
+        const auto desired{Pack(begin, middle)};
+        std::uint64_t result;
+        MPI_Compare_and_swap(&desired, &packed, &result, Parallel::MPIDataType<std::uint64_t>(),
+                             victim, fgRangeDisp, fWindow);
+        MPI_Win_flush(victim, fWindow);
+        this->CountMessage();
+        if (result == packed) {
+            return TaskRange{static_cast<T>(base + middle), static_cast<T>(base + end)};
+        }
+    }
+}
+
+template<std::integral T>
+auto WorkStealingScheduler<T>::Install(TaskRange range) -> bool {
+    // The local chunk is empty, so no one else modifies it. New offsets start
+    // beyond every offset used before, therefore a packed value never repeats
+    // and a thief holding a stale base always fails its CAS.
+    const auto packed{AtomicRead(fComm.rank(), fgRangeDisp)};
+    const auto begin{std::max(Begin(packed), End(packed)) + 1};
+    const auto length{static_cast<std::uint64_t>(range.last - range.first)};
+    if (begin + length > fgMaxOffset) [[unlikely]] {
+        // offsets exhausted, keep the range private as a single batch
+        fBase = static_cast<std::int64_t>(range.first);
+        this->fExecutingTask = range.first;
+        fBatchEnd = range.last;
+        return true;
+    }
+    fBase = static_cast<std::int64_t>(range.first) - static_cast<std::int64_t>(begin);
+    AtomicWrite(fComm.rank(), fgBaseDisp, std::bit_cast<std::uint64_t>(fBase));
+    AtomicWrite(fComm.rank(), fgRangeDisp, Pack(begin, begin + length));
+    // thieves may have taken all of it in the meantime
+    return ClaimLocal();
+}
+
+template<std::integral T>
+auto WorkStealingScheduler<T>::AtomicRead(int rank, MPI_Aint disp) -> std::uint64_t {
+    std::uint64_t result;
+    MPI_Fetch_and_op(nullptr, &result, Parallel::MPIDataType<std::uint64_t>(), rank, disp, MPI_NO_OP, fWindow);
+    MPI_Win_flush(rank, fWindow);
+    this->CountMessage();
+    return result;
+}
+
+template<std::integral T>
+auto WorkStealingScheduler<T>::AtomicWrite(int rank, MPI_Aint disp, std::uint64_t value) -> void {
+    MPI_Accumulate(&value, 1, Parallel::MPIDataType<std::uint64_t>(), rank, disp,
+                   1, Parallel::MPIDataType<std::uint64_t>(), MPI_REPLACE, fWindow);
+    MPI_Win_flush(rank, fWindow);
+    this->CountMessage();
+}
+
+} // namespace Mustard::inline Execution
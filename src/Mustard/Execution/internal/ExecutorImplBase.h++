@@ -20,6 +20,9 @@
 
 #include "Mustard/Execution/DefaultScheduler.h++"
 #include "Mustard/Execution/Scheduler.h++"
+#include "Mustard/Execution/internal/TaskDurationHistogram.h++"
+#include "Mustard/Execution/internal/TaskJournal.h++"
+#include "Mustard/Execution/internal/WorkStealingThreadPool.h++"
 #include "Mustard/IO/PrettyLog.h++"
 #include "Mustard/IO/Print.h++"
 #include "Mustard/Parallel/MPIPredefined.h++"
@@ -34,13 +37,24 @@
 #include "fmt/chrono.h"
 #include "fmt/format.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cmath>
 #include <concepts>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace Mustard::inline Execution::internal {
 
@@ -51,30 +65,69 @@ protected:
     using StopwatchDuration = muc::chrono::stopwatch::duration;
 
 public:
+    struct TaskDurationType {
+        StopwatchDuration p50;
+        StopwatchDuration p99;
+        StopwatchDuration max;
+    };
+
+    /// @brief Execution info of a process, or of all processes. For all processes,
+    /// counts and times are summed except the wall time (maximum), and task
+    /// durations are over all tasks.
     struct ExecutionInfoType {
         T nExecutedTask;
         StopwatchDuration wallTime;
         StopwatchDuration processorTime;
+        TaskDurationType taskDuration;  // approximate quantiles, see TaskDurationHistogram, zero unless profiled
+        StopwatchDuration schedulerTime; // in scheduler actions, including waiting for tasks, zero unless profiled
+        StopwatchDuration idleTailTime;  // waiting for the last process to finish the loop
+        unsigned long long nMessage;     // messages and RMA operations issued by the scheduler
+        std::vector<T> batchSizeTrace;   // local, empty for schedulers without batching
     };
 
 public:
     ExecutorImplBase(std::string executionName, std::string taskName, std::unique_ptr<Scheduler<T>> scheduler);
 
-    auto SwitchScheduler(std::string_view scheduler) -> void { SwitchScheduler(MakeCodedScheduler<T>(scheduler)); }
+    auto SwitchScheduler(std::string_view scheduler) -> void;
     auto SwitchScheduler(std::unique_ptr<Scheduler<T>> scheduler) -> void;
 
+    auto NThread() const -> auto { return fNThread; }
+    auto NThread(int n) -> void;
+    auto BatchPolicy() const -> auto { return fScheduler->BatchPolicy(); }
+    auto BatchPolicy(enum BatchPolicy policy) -> void;
+
     auto Task() const -> auto { return fScheduler->Task(); }
     auto NTask() const -> auto { return fScheduler->NTask(); }
     auto ExecutingTask() const -> auto { return fScheduler->ExecutingTask(); }
     auto NLocalExecutedTask() const -> auto { return fScheduler->NLocalExecutedTask(); }
+    /// @brief Tasks passed by the loop on this process, safe to read from any thread.
+    auto LocalProgress() const -> T { return fLocalProgress.load(std::memory_order::relaxed); }
 
     auto Executing() const -> bool { return fExecuting; }
+    /// @brief Mark a loop as executing before it starts, throws if one already is.
+    auto ClaimExecution() -> void;
+    auto ReleaseExecution() -> void { fExecuting = false; }
 
     auto PrintProgress() const -> auto { return fPrintProgress; }
     auto PrintProgress(bool a) -> void { fPrintProgress = a; }
     auto PrintProgressInterval() const -> auto { return fPrintProgressInterval; }
     auto PrintProgressInterval(muc::chrono::seconds<double> t) -> void { fPrintProgressInterval = std::max({}, t); }
 
+    auto Profile() const -> auto { return fProfile; }
+    auto Profile(bool a) -> void { fProfile = a; }
+
+    auto Journal() const -> const auto& { return fJournal; }
+    auto Journal(std::filesystem::path path) -> void;
+    auto JournalInterval() const -> auto { return fJournalInterval; }
+    auto JournalInterval(muc::chrono::seconds<double> t) -> void { fJournalInterval = std::max({}, t); }
+
+    auto PreTaskHook() const -> const auto& { return fPreTaskHook; }
+    auto PreTaskHook(std::function<auto(T)->void> hook) -> void { fPreTaskHook = std::move(hook); }
+    auto Lookahead() const -> auto { return fLookahead; }
+    auto Lookahead(int n) -> void;
+    auto LookaheadHook() const -> const auto& { return fLookaheadHook; }
+    auto LookaheadHook(std::function<auto(T)->void> hook) -> void { fLookaheadHook = std::move(hook); }
+
     auto ExecutionName() const -> const auto& { return fExecutionName; }
     auto ExecutionName(std::string name) -> void { fExecutionName = std::move(name); }
     auto TaskName() const -> const auto& { return fTaskName; }
@@ -83,26 +136,48 @@ public:
     auto ExecutionInfo() const -> const auto& { return fExecutionInfo; }
 
 protected:
+    auto MainLoop(std::invocable<T> auto&& F, std::invocable<T> auto&& Report) -> void;
+
     auto PreLoopReport() const -> void;
     auto PostLoopReport() const -> void;
 
+    /// @brief Write execution info of each process and the total as JSON (.json) or CSV (.csv).
+    auto WriteExecutionInfo(const std::filesystem::path& path, const std::vector<ExecutionInfoType>& perProcess,
+                            const ExecutionInfoType& total) const -> void;
+
+protected:
+    static auto ToTaskDuration(const TaskDurationHistogram& histogram) -> TaskDurationType;
+
 protected:
     static auto ToDayHrMinSecMs(StopwatchDuration s) -> std::string;
 
 protected:
     std::unique_ptr<Scheduler<T>> fScheduler;
 
-    bool fExecuting;
+    std::atomic<bool> fExecuting;
+    int fNThread;
 
     bool fPrintProgress;
     muc::chrono::seconds<double> fPrintProgressInterval;
 
+    bool fProfile;
+
+    std::filesystem::path fJournal;
+    muc::chrono::seconds<double> fJournalInterval;
+
+    std::function<auto(T)->void> fPreTaskHook;
+    int fLookahead;
+    std::function<auto(T)->void> fLookaheadHook;
+
     std::string fExecutionName;
     std::string fTaskName;
 
     std::chrono::system_clock::time_point fExecutionBeginTime;
     muc::chrono::stopwatch fStopwatch;
     muc::chrono::processor_stopwatch fProcessorStopwatch;
+    std::atomic<T> fLocalProgress;
+    TaskDurationHistogram fTaskDurationHistogram;
+    StopwatchDuration fSchedulerTime;
 
     ExecutionInfoType fExecutionInfo;
 };
@@ -23,15 +23,33 @@ template<std::integral T>
 ExecutorImplBase<T>::ExecutorImplBase(std::string executionName, std::string taskName, std::unique_ptr<Scheduler<T>> scheduler) :
     fScheduler{std::move(scheduler)},
     fExecuting{},
+    fNThread{1},
     fPrintProgress{true},
     fPrintProgressInterval{},
+    fProfile{},
+    fJournal{},
+    fJournalInterval{std::chrono::minutes{1}},
+    fPreTaskHook{},
+    fLookahead{},
+    fLookaheadHook{},
     fExecutionName{std::move(executionName)},
     fTaskName{std::move(taskName)},
     fExecutionBeginTime{},
     fStopwatch{},
     fProcessorStopwatch{},
+    fLocalProgress{},
+    fTaskDurationHistogram{},
+    fSchedulerTime{},
     fExecutionInfo{} {}
 
+template<std::integral T>
+    requires(Parallel::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto ExecutorImplBase<T>::SwitchScheduler(std::string_view scheduler) -> void {
+    const auto [schedulerCode, multithreading]{ParseSchedulerCode(scheduler)};
+    SwitchScheduler(MakeCodedScheduler<T>(schedulerCode));
+    NThread(multithreading ? DefaultNThreadPerProcess() : 1);
+}
+
 template<std::integral T>
     requires(Parallel::MPIPredefined<T> and sizeof(T) >= sizeof(short))
 auto ExecutorImplBase<T>::SwitchScheduler(std::unique_ptr<Scheduler<T>> scheduler) -> void {
@@ -39,8 +57,194 @@ auto ExecutorImplBase<T>::SwitchScheduler(std::unique_ptr<Scheduler<T>> schedule
         Throw<std::logic_error>("Try switching scheduler during executing");
     }
     const auto task{fScheduler->Task()};
+    const auto batchPolicy{fScheduler->BatchPolicy()};
     fScheduler = std::move(scheduler);
     fScheduler->Task(task);
+    fScheduler->BatchPolicy(batchPolicy);
+}
+
+template<std::integral T>
+    requires(Parallel::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto ExecutorImplBase<T>::ClaimExecution() -> void {
+    if (fExecuting.exchange(true)) {
+        Throw<std::logic_error>("Try launching during executing");
+    }
+}
+
+template<std::integral T>
+    requires(Parallel::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto ExecutorImplBase<T>::NThread(int n) -> void {
+    if (fExecuting) {
+        Throw<std::logic_error>("Try changing number of threads during executing");
+    }
+    if (n < 1) {
+        Throw<std::invalid_argument>(fmt::format("Number of threads ({}) < 1", n));
+    }
+    fNThread = n;
+}
+
+template<std::integral T>
+    requires(Parallel::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto ExecutorImplBase<T>::Lookahead(int n) -> void {
+    if (fExecuting) {
+        Throw<std::logic_error>("Try changing lookahead during executing");
+    }
+    if (n < 0) {
+        Throw<std::invalid_argument>(fmt::format("Lookahead ({}) < 0", n));
+    }
+    fLookahead = n;
+}
+
+template<std::integral T>
+    requires(Parallel::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto ExecutorImplBase<T>::BatchPolicy(enum BatchPolicy policy) -> void {
+    if (fExecuting) {
+        Throw<std::logic_error>("Try changing batch policy during executing");
+    }
+    fScheduler->BatchPolicy(policy);
+}
+
+template<std::integral T>
+    requires(Parallel::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto ExecutorImplBase<T>::Journal(std::filesystem::path path) -> void {
+    if (fExecuting) {
+        Throw<std::logic_error>("Try changing journal during executing");
+    }
+    fJournal = std::move(path);
+}
+
+template<std::integral T>
+    requires(Parallel::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto ExecutorImplBase<T>::MainLoop(std::invocable<T> auto&& F, std::invocable<T> auto&& Report) -> void {
+    std::optional<TaskJournal<T>> journal;
+    if (not fJournal.empty()) {
+        journal.emplace(fJournal, Task(), fJournalInterval);
+    }
+    // one histogram per thread, merged after the loop
+    std::vector<TaskDurationHistogram> taskDurationHistogram(fNThread);
+    fSchedulerTime = {};
+    const auto Skip{[&journal](T taskID) { return journal and journal->Completed(taskID); }};
+    // clock reads are paid per task only if profiled
+    const auto profile{fProfile};
+    const auto Execute{[this, profile, &journal, &taskDurationHistogram, &F](T taskID) {
+        const auto begin{profile ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{}};
+        if (fPreTaskHook) {
+            fPreTaskHook(taskID);
+        }
+        std::invoke(F, taskID);
+        if (profile) {
+            taskDurationHistogram[fNThread == 1 ? 0 : WorkerID::This()].Fill(std::chrono::steady_clock::now() - begin);
+        }
+        if (journal) {
+            journal->Record(taskID);
+        }
+    }};
+    // Report is called about once per print interval. The task count at which
+    // it is due is extrapolated from the current rate, so a task costs only an
+    // increment of the published counter.
+    fLocalProgress.store(0, std::memory_order::relaxed);
+    T nextSample{1};
+    auto lastReportTime{StopwatchDuration::zero()};
+    const auto Sample{[&, interval{std::chrono::duration_cast<StopwatchDuration>(fPrintProgressInterval)}](T taskID) {
+        const auto progress{static_cast<T>(fLocalProgress.fetch_add(1, std::memory_order::relaxed) + 1)};
+        if (progress != nextSample) [[likely]] {
+            return;
+        }
+        const auto elapsed{fStopwatch.read()};
+        if (elapsed - lastReportTime >= interval) {
+            Report(taskID);
+            lastReportTime = elapsed;
+        }
+        const auto remaining{interval - (elapsed - lastReportTime)};
+        const auto nAhead{elapsed.count() > 0 ? std::llround(progress / elapsed.count() * remaining.count()) : 1};
+        nextSample = static_cast<T>(progress + std::clamp<long long>(nAhead, 1, NTask()));
+    }};
+    const auto Schedule{[this, profile](auto&& Action) {
+        if (not profile) {
+            std::invoke(Action, *fScheduler);
+            return;
+        }
+        const auto begin{std::chrono::steady_clock::now()};
+        std::invoke(Action, *fScheduler);
+        fSchedulerTime += std::chrono::duration_cast<StopwatchDuration>(std::chrono::steady_clock::now() - begin);
+    }};
+    const auto Announce{[this](T taskID) {
+        if (fLookaheadHook) {
+            fLookaheadHook(taskID);
+        }
+    }};
+    if (fNThread == 1 and fLookahead == 0) {
+        while (ExecutingTask() != Task().last) {
+            Schedule(&Scheduler<T>::PreTaskAction);
+            const auto taskID{ExecutingTask()};
+            Ensures(taskID <= Task().last);
+            if (not Skip(taskID)) {
+                Announce(taskID);
+                Execute(taskID);
+                fScheduler->IncrementNLocalExecutedTask();
+            }
+            Schedule(&Scheduler<T>::PostTaskAction);
+            Sample(taskID);
+            if (journal) {
+                journal->Tick();
+            }
+        }
+    } else if (fNThread == 1) {
+        // Tasks are scheduled up to fLookahead ahead of the executing one, and
+        // announced once scheduled, so that their input can be prepared in advance.
+        std::deque<T> scheduled;
+        while (ExecutingTask() != Task().last or not scheduled.empty()) {
+            while (ExecutingTask() != Task().last and std::ssize(scheduled) <= fLookahead) {
+                Schedule(&Scheduler<T>::PreTaskAction);
+                const auto taskID{ExecutingTask()};
+                Ensures(taskID <= Task().last);
+                if (Skip(taskID)) {
+                    Sample(taskID);
+                } else {
+                    Announce(taskID);
+                    scheduled.push_back(taskID);
+                }
+                Schedule(&Scheduler<T>::PostTaskAction);
+            }
+            if (not scheduled.empty()) {
+                const auto taskID{scheduled.front()};
+                scheduled.pop_front();
+                Execute(taskID);
+                fScheduler->IncrementNLocalExecutedTask();
+                Sample(taskID);
+            }
+            if (journal) {
+                journal->Tick();
+            }
+        }
+    } else {
+        // This thread drives the scheduler and feeds the pool. A task counts as
+        // locally executed once submitted, the pool bounds the number of tasks in flight.
+        WorkStealingThreadPool<T, std::remove_reference_t<decltype(Execute)>> threadPool{fNThread, Execute, BindWorkerThread};
+        while (ExecutingTask() != Task().last) {
+            Schedule(&Scheduler<T>::PreTaskAction);
+            const auto taskID{ExecutingTask()};
+            Ensures(taskID <= Task().last);
+            if (not Skip(taskID)) {
+                Announce(taskID);
+                threadPool.Submit(taskID);
+                fScheduler->IncrementNLocalExecutedTask();
+            }
+            Schedule(&Scheduler<T>::PostTaskAction);
+            Sample(taskID);
+            if (journal) {
+                journal->Tick();
+            }
+        }
+        threadPool.Join();
+    }
+    if (journal) {
+        journal->Write();
+    }
+    fTaskDurationHistogram = {};
+    for (auto&& histogram : taskDurationHistogram) {
+        fTaskDurationHistogram += histogram;
+    }
 }
 
 template<std::integral T>
@@ -57,6 +261,9 @@ auto ExecutorImplBase<T>::PreLoopReport() const -> void {
     if (worldComm.is_valid()) {
         startText += fmt::format(" on {} process{}", worldComm.size(), worldComm.size() > 1 ? "es" : "");
     }
+    if (fNThread > 1) {
+        startText += fmt::format(" x {} threads", fNThread);
+    }
     Print("+----------------------------------> Start <----------------------------------+\n"
           "| {:75} |\n"
           "+----------------------------------> Start <----------------------------------+\n",
@@ -73,7 +280,8 @@ auto ExecutorImplBase<T>::PostLoopReport() const -> void {
     if (worldComm.is_valid() and worldComm.rank() != 0) {
         return;
     }
-    const auto& [_, maxTime, totalProcessorTime]{fExecutionInfo};
+    const auto& maxTime{fExecutionInfo.wallTime};
+    const auto& totalProcessorTime{fExecutionInfo.processorTime};
     using Seconds = muc::chrono::seconds<double>;
     using std::chrono_literals::operator""s;
     const auto now{std::chrono::system_clock::now()};
@@ -81,6 +289,9 @@ auto ExecutorImplBase<T>::PostLoopReport() const -> void {
     if (worldComm.is_valid()) {
         endText += fmt::format(" on {} process{}", worldComm.size(), worldComm.size() > 1 ? "es" : "");
     }
+    if (fNThread > 1) {
+        endText += fmt::format(" x {} threads", fNThread);
+    }
     Print("+-----------------------------------> End <-----------------------------------+\n"
           "| {:75} |\n"
           "| {:75} |\n"
@@ -93,6 +304,82 @@ auto ExecutorImplBase<T>::PostLoopReport() const -> void {
           fmt::format("  Processor time: {:.3f} seconds ({})", Seconds{totalProcessorTime}.count(), ToDayHrMinSecMs(totalProcessorTime)));
 }
 
+template<std::integral T>
+    requires(Parallel::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto ExecutorImplBase<T>::WriteExecutionInfo(const std::filesystem::path& path, const std::vector<ExecutionInfoType>& perProcess,
+                                             const ExecutionInfoType& total) const -> void {
+    const auto extension{path.extension()};
+    if (extension != ".json" and extension != ".csv") {
+        Throw<std::invalid_argument>(fmt::format("Execution info can only be written as .json or .csv (got {})", path));
+    }
+    std::ofstream os{path};
+    if (not os.is_open()) {
+        Throw<std::runtime_error>(fmt::format("Cannot open {} for writing", path));
+    }
+    using Seconds = muc::chrono::seconds<double>;
+    const auto Fields{[](const ExecutionInfoType& info) {
+        return std::tuple{info.nExecutedTask,
+                          Seconds{info.wallTime}.count(),
+                          Seconds{info.processorTime}.count(),
+                          Seconds{info.taskDuration.p50}.count(),
+                          Seconds{info.taskDuration.p99}.count(),
+                          Seconds{info.taskDuration.max}.count(),
+                          Seconds{info.schedulerTime}.count(),
+                          Seconds{info.idleTailTime}.count(),
+                          info.nMessage};
+    }};
+    if (extension == ".csv") {
+        os << "process,nExecutedTask,wallTime,processorTime,taskDurationP50,taskDurationP99,taskDurationMax,"
+              "schedulerTime,idleTailTime,nMessage\n";
+        const auto WriteRow{[&](auto&& process, const ExecutionInfoType& info) {
+            const auto [executed, wall, processor, p50, p99, max, scheduler, idleTail, nMessage]{Fields(info)};
+            os << fmt::format("{},{},{},{},{},{},{},{},{},{}\n",
+                              process, executed, wall, processor, p50, p99, max, scheduler, idleTail, nMessage);
+        }};
+        for (gsl::index rank{}; rank < std::ssize(perProcess); ++rank) {
+            WriteRow(rank, perProcess[rank]);
+        }
+        WriteRow("total", total);
+        return;
+    }
+    const auto Quote{[](std::string_view text) {
+        std::string result{'"'};
+        for (auto c : text) {
+            if (c == '"' or c == '\\') {
+                result += '\\';
+            }
+            result += c;
+        }
+        return result += '"';
+    }};
+    const auto ToJSON{[&](const ExecutionInfoType& info) {
+        const auto [executed, wall, processor, p50, p99, max, scheduler, idleTail, nMessage]{Fields(info)};
+        return fmt::format(R"({{"nExecutedTask": {}, "wallTime": {}, "processorTime": {}, )"
+                           R"("taskDuration": {{"p50": {}, "p99": {}, "max": {}}}, )"
+                           R"("schedulerTime": {}, "idleTailTime": {}, "nMessage": {}}})",
+                           executed, wall, processor, p50, p99, max, scheduler, idleTail, nMessage);
+    }};
+    os << "{\n"
+       << fmt::format("  \"executionName\": {},\n", Quote(fExecutionName))
+       << fmt::format("  \"nThread\": {},\n", fNThread)
+       << "  \"timeUnit\": \"s\",\n"
+       << "  \"process\": [";
+    for (gsl::index rank{}; rank < std::ssize(perProcess); ++rank) {
+        os << (rank == 0 ? "\n    " : ",\n    ") << ToJSON(perProcess[rank]);
+    }
+    os << "\n  ],\n"
+       << "  \"total\": " << ToJSON(total) << "\n"
+       << "}\n";
+}
+
+template<std::integral T>
+    requires(Parallel::MPIPredefined<T> and sizeof(T) >= sizeof(short))
+auto ExecutorImplBase<T>::ToTaskDuration(const TaskDurationHistogram& histogram) -> TaskDurationType {
+    return {.p50 = std::chrono::duration_cast<StopwatchDuration>(histogram.Quantile(0.5)),
+            .p99 = std::chrono::duration_cast<StopwatchDuration>(histogram.Quantile(0.99)),
+            .max = std::chrono::duration_cast<StopwatchDuration>(histogram.Max())};
+}
+
 template<std::integral T>
     requires(Parallel::MPIPredefined<T> and sizeof(T) >= sizeof(short))
 auto ExecutorImplBase<T>::ToDayHrMinSecMs(StopwatchDuration duration) -> std::string {
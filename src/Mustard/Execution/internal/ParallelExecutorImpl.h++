@@ -21,6 +21,7 @@
 #include "Mustard/Env/MPIEnv.h++"
 #include "Mustard/Execution/Scheduler.h++"
 #include "Mustard/Execution/internal/ExecutorImplBase.h++"
+#include "Mustard/Execution/internal/TaskDurationHistogram.h++"
 #include "Mustard/IO/PrettyLog.h++"
 #include "Mustard/IO/Print.h++"
 #include "Mustard/Utility/FormatToLocalTime.h++"
@@ -40,10 +41,14 @@
 #include <chrono>
 #include <cmath>
 #include <concepts>
+#include <filesystem>
 #include <functional>
+#include <ranges>
 #include <stdexcept>
+#include <string>
 #include <string_view>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -57,7 +62,10 @@ public:
     auto NProcess() const -> int { return mplr::comm_world().size(); }
 
     auto operator()(struct Scheduler<T>::Task task, std::invocable<T> auto&& F) -> T;
+    template<typename A>
+    auto CombineOverProcesses(A value, auto&& Combine) const -> A;
     auto PrintExecutionSummary() const -> void;
+    auto WriteExecutionInfo(const std::filesystem::path& path) const -> void;
 
 private:
     auto PostTaskReport(T iEnded) const -> void;
@@ -67,6 +75,9 @@ private:
     using typename ExecutorImplBase<T>::ExecutionInfoType;
 
 private:
+    // private duplicate of the world communicator, keeps loops of different executors apart.
+    // Duplicating is collective, so are construction and destruction of the executor
+    mplr::communicator fComm;
     std::vector<ExecutionInfoType> fExecutionInfoList;
 };
 
@@ -21,6 +21,7 @@ namespace Mustard::inline Execution::internal {
 template<std::integral T>
 ParallelExecutorImpl<T>::ParallelExecutorImpl(std::string executionName, std::string taskName, std::unique_ptr<Scheduler<T>> scheduler) :
     ExecutorImplBase<T>{std::move(executionName), std::move(taskName), std::move(scheduler)},
+    fComm{mplr::comm_world(), mplr::info{}},
     fExecutionInfoList{} {
     using std::chrono_literals::operator""s;
     this->fPrintProgressInterval = 3s;
@@ -35,10 +36,9 @@ auto ParallelExecutorImpl<T>::operator()(struct Scheduler<T>::Task task, std::in
     if (task.last == task.first) {
         return 0;
     }
-    const auto worldComm{mplr::comm_world()};
     const auto nTask{task.last - task.first};
-    if (nTask < static_cast<T>(worldComm.size())) {
-        Throw<std::runtime_error>(fmt::format("Number of tasks ({}) < number of processes ({})", nTask, worldComm.size()));
+    if (nTask < static_cast<T>(fComm.size())) {
+        Throw<std::runtime_error>(fmt::format("Number of tasks ({}) < number of processes ({})", nTask, fComm.size()));
     }
     this->fScheduler->Task(task);
     this->fScheduler->Reset();
@@ -46,55 +46,114 @@ auto ParallelExecutorImpl<T>::operator()(struct Scheduler<T>::Task task, std::in
     Expects(this->NLocalExecutedTask() == 0);
     Expects(this->fScheduler->NExecutedTaskEstimation().second == 0);
     // initialize
-    this->fExecuting = true;
     this->fScheduler->PreLoopAction();
-    worldComm.ibarrier().wait(mplr::duty_ratio::preset::moderate);
+    fComm.ibarrier().wait(mplr::duty_ratio::preset::moderate);
     this->fExecutionBeginTime = std::chrono::system_clock::now();
     this->fStopwatch.reset();
     this->fProcessorStopwatch.reset();
     this->PreLoopReport();
     // main loop
-    while (this->ExecutingTask() != this->Task().last) {
-        this->fScheduler->PreTaskAction();
-        const auto taskID{this->ExecutingTask()};
-        Ensures(taskID <= this->Task().last);
-        std::invoke(std::forward<decltype(F)>(F), taskID);
-        this->fScheduler->IncrementNLocalExecutedTask();
-        this->fScheduler->PostTaskAction();
-        PostTaskReport(taskID);
-    }
+    this->MainLoop(std::forward<decltype(F)>(F), [this](T taskID) { PostTaskReport(taskID); });
     // finalize
-    using ExecutionInfoTuple = std::tuple<T, typename StopwatchDuration::rep, typename StopwatchDuration::rep>;
-    std::tuple executionInfo{this->NLocalExecutedTask(), this->fStopwatch.read().count(), this->fProcessorStopwatch.read().count()};
-    std::vector<ExecutionInfoTuple> executionInfoList(worldComm.rank() == 0 ? worldComm.size() : 0);
-    auto gatherExecutionInfo{worldComm.igather(0, executionInfo, executionInfoList.data())};
+    using Rep = typename StopwatchDuration::rep;
+    using ExecutionInfoTuple = std::tuple<T, Rep, Rep, Rep, Rep, Rep, Rep, Rep, unsigned long long>;
+    const auto localTaskDuration{this->ToTaskDuration(this->fTaskDurationHistogram)};
+    ExecutionInfoTuple executionInfo{this->NLocalExecutedTask(), this->fStopwatch.read().count(), this->fProcessorStopwatch.read().count(),
+                                     localTaskDuration.p50.count(), localTaskDuration.p99.count(), localTaskDuration.max.count(),
+                                     this->fSchedulerTime.count(), Rep{}, this->fScheduler->NMessage()};
+    std::vector<ExecutionInfoTuple> executionInfoList(fComm.rank() == 0 ? fComm.size() : 0);
+    auto gatherExecutionInfo{fComm.igather(0, executionInfo, executionInfoList.data())};
+    auto taskDurationBin{this->fTaskDurationHistogram.Bin()};
+    constexpr auto AddBin{[](auto a, const auto& b) {
+        std::ranges::transform(a, b, a.begin(), std::plus{});
+        return a;
+    }};
+    auto reduceTaskDuration{fComm.ireduce(AddBin, 0, taskDurationBin)};
     this->fScheduler->PostLoopAction();
     gatherExecutionInfo.wait(mplr::duty_ratio::preset::relaxed);
+    reduceTaskDuration.wait(mplr::duty_ratio::preset::relaxed);
     constexpr auto ToExecutionInfo{[](const ExecutionInfoTuple& t) -> ExecutionInfoType {
         return {.nExecutedTask = get<0>(t),
                 .wallTime = StopwatchDuration{get<1>(t)},
-                .processorTime = StopwatchDuration{get<2>(t)}};
+                .processorTime = StopwatchDuration{get<2>(t)},
+                .taskDuration = {.p50 = StopwatchDuration{get<3>(t)},
+                                 .p99 = StopwatchDuration{get<4>(t)},
+                                 .max = StopwatchDuration{get<5>(t)}},
+                .schedulerTime = StopwatchDuration{get<6>(t)},
+                .idleTailTime = StopwatchDuration{get<7>(t)},
+                .nMessage = get<8>(t),
+                .batchSizeTrace = {}};
     }};
-    if (worldComm.rank() == 0) {
-        fExecutionInfoList.resize(worldComm.size());
+    if (fComm.rank() == 0) {
+        fExecutionInfoList.resize(fComm.size());
         std::ranges::transform(executionInfoList, fExecutionInfoList.begin(), ToExecutionInfo);
-        auto& [totalExecutedTask, maxTime, totalProcessorTime]{executionInfo};
-        totalExecutedTask = muc::ranges::transform_reduce(
-            fExecutionInfoList, T{}, std::plus{}, [](auto&& a) { return a.nExecutedTask; });
-        maxTime = std::ranges::max_element(
-                      fExecutionInfoList, std::less{}, [](auto&& a) { return a.wallTime; })
-                      ->wallTime.count();
-        totalProcessorTime = muc::ranges::transform_reduce(
-                                 fExecutionInfoList, StopwatchDuration::zero(), std::plus{}, [](auto&& a) { return a.processorTime; })
-                                 .count();
+        const auto maxTime{std::ranges::max_element(
+                               fExecutionInfoList, std::less{}, [](auto&& a) { return a.wallTime; })
+                               ->wallTime};
+        for (auto&& info : fExecutionInfoList) {
+            info.idleTailTime = maxTime - info.wallTime;
+        }
+        const auto Sum{[this](auto&& Projection) {
+            return muc::ranges::transform_reduce(
+                fExecutionInfoList, std::invoke_result_t<decltype(Projection), const ExecutionInfoType&>{}, std::plus{}, Projection);
+        }};
+        TaskDurationHistogram taskDurationHistogram;
+        taskDurationHistogram.Bin() = taskDurationBin;
+        taskDurationHistogram.Max(std::chrono::duration_cast<TaskDurationHistogram::Duration>(
+            std::ranges::max_element(
+                fExecutionInfoList, std::less{}, [](auto&& a) { return a.taskDuration.max; })
+                ->taskDuration.max));
+        const auto taskDuration{this->ToTaskDuration(taskDurationHistogram)};
+        executionInfo = {Sum([](auto&& a) { return a.nExecutedTask; }),
+                         maxTime.count(),
+                         Sum([](auto&& a) { return a.processorTime; }).count(),
+                         taskDuration.p50.count(),
+                         taskDuration.p99.count(),
+                         taskDuration.max.count(),
+                         Sum([](auto&& a) { return a.schedulerTime; }).count(),
+                         Sum([](auto&& a) { return a.idleTailTime; }).count(),
+                         Sum([](auto&& a) { return a.nMessage; })};
+    }
+    fComm.ibcast(0, executionInfo).wait(mplr::duty_ratio::preset::relaxed);
+    // all processes have finished
+    if (fComm.rank() == 0 and not this->fJournal.empty()) {
+        TaskJournal<T>::Remove(this->fJournal);
     }
-    worldComm.ibcast(0, executionInfo).wait(mplr::duty_ratio::preset::relaxed);
     this->fExecutionInfo = ToExecutionInfo(executionInfo);
-    this->fExecuting = false;
+    this->fExecutionInfo.batchSizeTrace = this->fScheduler->BatchSizeTrace();
     this->PostLoopReport();
     return this->NLocalExecutedTask();
 }
 
+template<std::integral T>
+template<typename A>
+auto ParallelExecutorImpl<T>::CombineOverProcesses(A value, auto&& Combine) const -> A {
+    const auto CombineList{[&](std::vector<A>& list) {
+        auto result{std::move(list.front())};
+        for (auto&& v : list | std::views::drop(1)) {
+            result = std::invoke(Combine, std::move(result), std::move(v));
+        }
+        return result;
+    }};
+    // intra-node to node leaders, then across node leaders
+    const auto& mpiEnv{Env::MPIEnv::Instance()};
+    const auto& intraNodeComm{mpiEnv.IntraNodeComm()};
+    const auto& interNodeComm{mpiEnv.InterNodeComm()};
+    std::vector<A> list(intraNodeComm.rank() == 0 ? intraNodeComm.size() : 0);
+    intraNodeComm.igather(0, value, list.data()).wait(mplr::duty_ratio::preset::relaxed);
+    if (interNodeComm.is_valid()) {
+        value = CombineList(list);
+        list.resize(interNodeComm.rank() == 0 ? interNodeComm.size() : 0);
+        interNodeComm.igather(0, value, list.data()).wait(mplr::duty_ratio::preset::relaxed);
+        if (interNodeComm.rank() == 0) {
+            value = CombineList(list);
+        }
+        interNodeComm.ibcast(0, value).wait(mplr::duty_ratio::preset::relaxed);
+    }
+    intraNodeComm.ibcast(0, value).wait(mplr::duty_ratio::preset::relaxed);
+    return value;
+}
+
 template<std::integral T>
 auto ParallelExecutorImpl<T>::PrintExecutionSummary() const -> void {
     const auto worldComm{mplr::comm_world()};
@@ -111,17 +170,50 @@ auto ParallelExecutorImpl<T>::PrintExecutionSummary() const -> void {
     Expects(ssize(fExecutionInfoList) == worldComm.size());
     using Seconds = muc::chrono::seconds<double>;
     for (int rank{}; rank < worldComm.size(); ++rank) {
-        const auto& [executed, time, processorTime]{fExecutionInfoList[rank]};
+        const auto& info{fExecutionInfoList[rank]};
         PrintLn("| {:16} | {:17} | {:16.3f} | {:17.3f} |",
-                rank, executed, Seconds{time}.count(), Seconds{processorTime}.count());
+                rank, info.nExecutedTask, Seconds{info.wallTime}.count(), Seconds{info.processorTime}.count());
     }
-    const auto& [nTotalExecutedTask, maxTime, totalProcessorTime]{this->fExecutionInfo};
+    const auto& total{this->fExecutionInfo};
     if (worldComm.size() > 1) {
         PrintLn("+------------------+-------------------+------------------+-------------------+\n"
                 "| Total or max     | {:17} | {:16.3f} | {:17.3f} |",
-                nTotalExecutedTask, Seconds{maxTime}.count(), Seconds{totalProcessorTime}.count());
+                total.nExecutedTask, Seconds{total.wallTime}.count(), Seconds{total.processorTime}.count());
     }
     PrintLn("+------------------+--------------> Summary <-------------+-------------------+");
+    Print("+--------+----------+--------> Load balance (s) <-----+-----------+-----------+\n"
+          "| Rank   | Task p50 | Task p99 | Task max | Scheduler | Idle tail | Messages  |\n"
+          "+--------+----------+----------+----------+-----------+-----------+-----------+\n");
+    // task durations and scheduler time are not measured unless profiled
+    const auto Profiled{[this](std::string_view format, auto time) {
+        return this->fProfile ? fmt::format(fmt::runtime(format), Seconds{time}.count()) : "-";
+    }};
+    const auto PrintLoadBalance{[&](auto&& rank, const ExecutionInfoType& info) {
+        PrintLn("| {:6} | {:>8} | {:>8} | {:>8} | {:>9} | {:9.3f} | {:9} |",
+                rank, Profiled("{:.3g}", info.taskDuration.p50), Profiled("{:.3g}", info.taskDuration.p99),
+                Profiled("{:.3g}", info.taskDuration.max), Profiled("{:.3f}", info.schedulerTime),
+                Seconds{info.idleTailTime}.count(), info.nMessage);
+    }};
+    for (int rank{}; rank < worldComm.size(); ++rank) {
+        PrintLoadBalance(rank, fExecutionInfoList[rank]);
+    }
+    if (worldComm.size() > 1) {
+        PrintLn("+--------+----------+----------+----------+-----------+-----------+-----------+");
+        PrintLoadBalance("Total", total);
+    }
+    PrintLn("+--------+----------+--------> Load balance (s) <-----+-----------+-----------+");
+}
+
+template<std::integral T>
+auto ParallelExecutorImpl<T>::WriteExecutionInfo(const std::filesystem::path& path) const -> void {
+    if (mplr::comm_world().rank() != 0) {
+        return;
+    }
+    if (fExecutionInfoList.empty() or this->fExecuting) {
+        PrintWarning("Execution info not available for now");
+        return;
+    }
+    ExecutorImplBase<T>::WriteExecutionInfo(path, fExecutionInfoList, this->fExecutionInfo);
 }
 
 template<std::integral T>
@@ -129,13 +221,10 @@ auto ParallelExecutorImpl<T>::PostTaskReport(T iEnded) const -> void {
     if (not this->fPrintProgress) {
         return;
     }
+    // called by MainLoop once per print interval
     const auto [goodEstimation, nExecutedTask]{this->fScheduler->NExecutedTaskEstimation()};
     const auto elapsed{this->fStopwatch.read()};
     const auto speed{static_cast<double>(nExecutedTask) / elapsed.count()};
-    const std::chrono::duration<double, typename StopwatchDuration::period> printInterval{this->fPrintProgressInterval};
-    if ((iEnded + 1) % std::max(1ll, muc::llround(speed * printInterval.count())) != 0) {
-        return;
-    }
     const auto worldComm{mplr::comm_world()};
     const auto perSecondSpeed{muc::chrono::seconds<double>{1} / StopwatchDuration{1} * speed};
     const auto now{std::chrono::system_clock::now()};
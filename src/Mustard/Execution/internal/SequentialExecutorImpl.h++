@@ -29,6 +29,7 @@
 
 #include <chrono>
 #include <concepts>
+#include <filesystem>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -44,7 +45,10 @@ public:
     auto NProcess() const -> int { return 1; }
 
     auto operator()(struct Scheduler<T>::Task task, std::invocable<T> auto&& F) -> T;
+    template<typename A>
+    auto CombineOverProcesses(A value, auto&&) const -> A { return value; }
     auto PrintExecutionSummary() const -> void;
+    auto WriteExecutionInfo(const std::filesystem::path& path) const -> void;
 
 private:
     ProgressBar fProgressBar;
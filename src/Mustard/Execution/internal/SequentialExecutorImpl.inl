@@ -42,7 +42,6 @@ auto SequentialExecutorImpl<T>::operator()(struct Scheduler<T>::Task task, std::
     Expects(this->NLocalExecutedTask() == 0);
     Expects(this->fScheduler->NExecutedTaskEstimation().second == 0);
     // initialize
-    this->fExecuting = true;
     this->fScheduler->PreLoopAction();
     this->fExecutionBeginTime = std::chrono::system_clock::now();
     this->fStopwatch.reset();
@@ -50,30 +49,29 @@ auto SequentialExecutorImpl<T>::operator()(struct Scheduler<T>::Task task, std::
     this->PreLoopReport();
     // main loop
     fProgressBar.Start(nTask);
-    while (this->ExecutingTask() != this->Task().last) {
-        this->fScheduler->PreTaskAction();
-        const auto taskID{this->ExecutingTask()};
-        Ensures(taskID <= this->Task().last);
-        std::invoke(std::forward<decltype(F)>(F), taskID);
-        this->fScheduler->IncrementNLocalExecutedTask();
-        this->fScheduler->PostTaskAction();
-        fProgressBar.Tick();
-    }
+    this->MainLoop(std::forward<decltype(F)>(F), [this](T) { fProgressBar.Update(this->LocalProgress()); });
     fProgressBar.Complete();
     // finalize
+    if (not this->fJournal.empty()) {
+        TaskJournal<T>::Remove(this->fJournal);
+    }
     this->fExecutionInfo.nExecutedTask = this->NLocalExecutedTask();
     this->fExecutionInfo.wallTime = this->fStopwatch.read();
     this->fExecutionInfo.processorTime = this->fProcessorStopwatch.read();
+    this->fExecutionInfo.taskDuration = this->ToTaskDuration(this->fTaskDurationHistogram);
+    this->fExecutionInfo.schedulerTime = this->fSchedulerTime;
+    this->fExecutionInfo.idleTailTime = {};
+    this->fExecutionInfo.nMessage = this->fScheduler->NMessage();
+    this->fExecutionInfo.batchSizeTrace = this->fScheduler->BatchSizeTrace();
     this->fScheduler->PostLoopAction();
-    this->fExecuting = false;
     this->PostLoopReport();
     return this->NLocalExecutedTask();
 }
 
 template<std::integral T>
 auto SequentialExecutorImpl<T>::PrintExecutionSummary() const -> void {
-    const auto& [executed, time, processorTime]{this->fExecutionInfo};
-    if (executed == 0 or this->fExecuting) {
+    const auto& info{this->fExecutionInfo};
+    if (info.nExecutedTask == 0 or this->fExecuting) {
         PrintWarning("Execution summary not available for now");
         return;
     }
@@ -81,9 +79,25 @@ auto SequentialExecutorImpl<T>::PrintExecutionSummary() const -> void {
     Print("+-------------------------+-------> Summary <-------+-------------------------+\n"
           "| Executed                | Wall time (s)           | Processor time (s)      |\n"
           "+-------------------------+-------------------------+-------------------------+\n"
-          "| {:23} | {:23.3f} | {:23.3f} |\n"
-          "+-------------------------+-------> Summary <-------+-------------------------+\n",
-          executed, Seconds{time}.count(), Seconds{processorTime}.count());
+          "| {:23} | {:23.3f} | {:23.3f} |\n",
+          info.nExecutedTask, Seconds{info.wallTime}.count(), Seconds{info.processorTime}.count());
+    if (this->fProfile) {
+        Print("+-------------------------+-------------------------+-------------------------+\n"
+              "| Task p50 (s)            | Task p99 (s)            | Task max (s)            |\n"
+              "+-------------------------+-------------------------+-------------------------+\n"
+              "| {:23.3g} | {:23.3g} | {:23.3g} |\n",
+              Seconds{info.taskDuration.p50}.count(), Seconds{info.taskDuration.p99}.count(), Seconds{info.taskDuration.max}.count());
+    }
+    Print("+-------------------------+-------> Summary <-------+-------------------------+\n");
+}
+
+template<std::integral T>
+auto SequentialExecutorImpl<T>::WriteExecutionInfo(const std::filesystem::path& path) const -> void {
+    if (this->fExecutionInfo.nExecutedTask == 0 or this->fExecuting) {
+        PrintWarning("Execution info not available for now");
+        return;
+    }
+    ExecutorImplBase<T>::WriteExecutionInfo(path, {this->fExecutionInfo}, this->fExecutionInfo);
 }
 
 } // namespace Mustard::inline Execution::internal
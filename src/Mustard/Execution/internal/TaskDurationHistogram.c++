@@ -0,0 +1,83 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Execution/internal/TaskDurationHistogram.h++"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <numeric>
+
+namespace Mustard::inline Execution::internal {
+
+TaskDurationHistogram::TaskDurationHistogram() :
+    fBin{},
+    fMax{} {}
+
+auto TaskDurationHistogram::Fill(Duration t) -> void {
+    const auto ns{static_cast<std::uint64_t>(std::max<Duration::rep>(0, t.count()))};
+    ++fBin[BinIndex(ns)];
+    fMax = std::max(fMax, t);
+}
+
+auto TaskDurationHistogram::operator+=(const TaskDurationHistogram& other) -> TaskDurationHistogram& {
+    std::ranges::transform(fBin, other.fBin, fBin.begin(), std::plus{});
+    fMax = std::max(fMax, other.fMax);
+    return *this;
+}
+
+auto TaskDurationHistogram::Count() const -> unsigned long long {
+    return std::reduce(fBin.cbegin(), fBin.cend(), 0ull);
+}
+
+auto TaskDurationHistogram::Quantile(double q) const -> Duration {
+    const auto count{Count()};
+    if (count == 0) {
+        return {};
+    }
+    const auto rank{static_cast<unsigned long long>(std::ceil(std::clamp(q, 0., 1.) * count))};
+    unsigned long long cumulative{};
+    for (int i{}; i < fgNBin; ++i) {
+        cumulative += fBin[i];
+        if (cumulative >= std::max(1ull, rank)) {
+            const auto center{(BinLowerEdge(i) + (i + 1 < fgNBin ? BinLowerEdge(i + 1) : BinLowerEdge(i))) / 2};
+            return std::min(Duration{static_cast<Duration::rep>(center)}, fMax);
+        }
+    }
+    return fMax;
+}
+
+auto TaskDurationHistogram::BinIndex(std::uint64_t ns) -> int {
+    if (ns < 4) {
+        return static_cast<int>(ns);
+    }
+    const auto exponent{std::bit_width(ns) - 1}; // >= 2
+    const auto mantissa{static_cast<int>((ns >> (exponent - 2)) & 0b11)};
+    return 4 * (exponent - 1) + mantissa;
+}
+
+auto TaskDurationHistogram::BinLowerEdge(int index) -> std::uint64_t {
+    if (index < 4) {
+        return index;
+    }
+    const auto exponent{index / 4 + 1};
+    const auto mantissa{static_cast<std::uint64_t>(index % 4)};
+    return (4 + mantissa) << (exponent - 2);
+}
+
+} // namespace Mustard::inline Execution::internal
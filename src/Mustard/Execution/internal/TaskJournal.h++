@@ -0,0 +1,113 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Execution/Scheduler.h++"
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/Utility/NonCopyableBase.h++"
+
+#include "CLHEP/Random/Random.h"
+
+#include "mplr/mplr.hpp"
+
+#include "muc/chrono"
+
+#include "fmt/format.h"
+#include "fmt/std.h"
+
+#include <algorithm>
+#include <chrono>
+#include <concepts>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace Mustard::inline Execution::internal {
+
+/// @brief Checkpoint journal of completed tasks.
+///
+/// Each process periodically writes the task intervals it has completed,
+/// followed by the state of the CLHEP random engine, to its own journal file
+/// (`<stem>_mpi<rank><ext>` next to the given path, or the path itself in a
+/// single-process run). Files are replaced atomically.
+///
+/// On construction, journal files of all processes of a previous execution
+/// over the same task range are read, so that completed tasks can be skipped
+/// regardless of the number of processes or the scheduler. The random engine
+/// state is restored from the file of the same rank.
+///
+/// Journal files are removed once the execution has finished normally on all
+/// processes, so a journal found on construction is always left behind by an
+/// interrupted execution.
+///
+/// @note Use a distinct path for each execution, since a journal is
+/// identified by its path and task range only.
+template<std::integral T>
+class TaskJournal final : public NonCopyableBase {
+public:
+    TaskJournal(const std::filesystem::path& path, struct Scheduler<T>::Task task, muc::chrono::seconds<double> interval);
+
+    auto Completed(T taskID) const -> bool;
+    auto NCompleted() const -> auto { return fNCompleted; }
+    /// @brief Mark a task as completed. Thread-safe.
+    auto Record(T taskID) -> void;
+    /// @brief Write the journal if the interval has elapsed since the last write.
+    auto Tick() -> void;
+    auto Write() -> void;
+
+    /// @brief Remove journal files of all processes. Call on one process after
+    /// the execution has finished on all processes.
+    static auto Remove(const std::filesystem::path& path) -> void;
+
+private:
+    using IntervalSet = std::map<T, T>;
+
+private:
+    auto Load(const std::filesystem::path& file, bool ownFile) -> void;
+
+    /// @brief Journal files of any process, possibly from a run with a different number of processes.
+    static auto ForEachFile(const std::filesystem::path& path, auto&& F) -> void;
+
+    static auto Insert(IntervalSet& set, T taskID) -> void;
+    static auto Insert(IntervalSet& set, T first, T last) -> void;
+    static auto Contains(const IntervalSet& set, T taskID) -> bool;
+
+private:
+    std::filesystem::path fFile;
+    struct Scheduler<T>::Task fTask;
+    std::chrono::steady_clock::duration fInterval;
+    std::chrono::steady_clock::time_point fLastWriteTime;
+
+    IntervalSet fCompleted;
+    T fNCompleted;
+    std::mutex fRecordedMutex;
+    IntervalSet fRecorded;
+
+    static constexpr std::string_view fgHeader{"MustardTaskJournal"};
+};
+
+} // namespace Mustard::inline Execution::internal
+
+#include "Mustard/Execution/internal/TaskJournal.inl"
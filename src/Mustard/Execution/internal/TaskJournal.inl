@@ -0,0 +1,212 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::inline Execution::internal {
+
+template<std::integral T>
+TaskJournal<T>::TaskJournal(const std::filesystem::path& path, struct Scheduler<T>::Task task, muc::chrono::seconds<double> interval) :
+    NonCopyableBase{},
+    fFile{},
+    fTask{task},
+    fInterval{std::chrono::duration_cast<std::chrono::steady_clock::duration>(interval)},
+    fLastWriteTime{std::chrono::steady_clock::now()},
+    fCompleted{},
+    fNCompleted{},
+    fRecordedMutex{},
+    fRecorded{} {
+    const auto worldComm{mplr::available() ? mplr::comm_world() : mplr::comm_null()};
+    const auto multiprocess{worldComm.is_valid() and worldComm.size() > 1};
+    const auto directory{path.has_parent_path() ? path.parent_path() : "."};
+    fFile = multiprocess ? directory / fmt::format("{}_mpi{}{}", path.stem().string(), worldComm.rank(), path.extension().string()) :
+                           path;
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    ForEachFile(path, [this](const std::filesystem::path& file) {
+        Load(file, file.filename() == fFile.filename());
+    });
+    for (auto&& [first, last] : fCompleted) {
+        fNCompleted += last - first;
+    }
+}
+
+template<std::integral T>
+auto TaskJournal<T>::Completed(T taskID) const -> bool {
+    return Contains(fCompleted, taskID);
+}
+
+template<std::integral T>
+auto TaskJournal<T>::Record(T taskID) -> void {
+    const std::scoped_lock lock{fRecordedMutex};
+    Insert(fRecorded, taskID);
+}
+
+template<std::integral T>
+auto TaskJournal<T>::Tick() -> void {
+    if (std::chrono::steady_clock::now() - fLastWriteTime >= fInterval) [[unlikely]] {
+        Write();
+    }
+}
+
+template<std::integral T>
+auto TaskJournal<T>::Write() -> void {
+    fLastWriteTime = std::chrono::steady_clock::now();
+    IntervalSet recorded;
+    {
+        const std::scoped_lock lock{fRecordedMutex};
+        recorded = fRecorded;
+    }
+    auto temporary{fFile};
+    temporary += ".tmp";
+    {
+        std::ofstream os{temporary};
+        if (not os.is_open()) [[unlikely]] {
+            PrintWarning(fmt::format("Cannot open {}, task journal not written", temporary));
+            return;
+        }
+        os << fgHeader << ' ' << fTask.first << ' ' << fTask.last << '\n';
+        for (auto&& [first, last] : recorded) {
+            os << "done " << first << ' ' << last << '\n';
+        }
+        os << "engine\n";
+        CLHEP::HepRandom::getTheEngine()->put(os);
+    }
+    // atomic replacement, a preempted write leaves the previous journal intact
+    std::error_code error;
+    std::filesystem::rename(temporary, fFile, error);
+    if (error) [[unlikely]] {
+        PrintWarning(fmt::format("Cannot replace {} ({}), task journal not written", fFile, error.message()));
+        std::filesystem::remove(temporary, error);
+    }
+}
+
+template<std::integral T>
+auto TaskJournal<T>::Remove(const std::filesystem::path& path) -> void {
+    ForEachFile(path, [](const std::filesystem::path& file) {
+        std::error_code error;
+        if (not std::filesystem::remove(file, error) and error) {
+            PrintWarning(fmt::format("Cannot remove task journal {} ({})", file, error.message()));
+        }
+    });
+}
+
+template<std::integral T>
+auto TaskJournal<T>::Load(const std::filesystem::path& file, bool ownFile) -> void {
+    std::ifstream is{file};
+    std::string tag;
+    T first;
+    T last;
+    if (not(is >> tag >> first >> last) or tag != fgHeader) {
+        PrintWarning(fmt::format("{} is not a task journal, ignored", file));
+        return;
+    }
+    if (first != fTask.first or last != fTask.last) {
+        PrintWarning(fmt::format("Task range [{}, {}) in {} differs from [{}, {}), journal ignored",
+                                 first, last, file, fTask.first, fTask.last));
+        return;
+    }
+    while (is >> tag) {
+        if (tag == "done" and is >> first >> last) {
+            Insert(fCompleted, first, last);
+            if (ownFile) {
+                Insert(fRecorded, first, last);
+            }
+        } else if (tag == "engine") {
+            if (ownFile) {
+                CLHEP::HepRandom::getTheEngine()->get(is);
+            }
+            break;
+        }
+    }
+}
+
+template<std::integral T>
+auto TaskJournal<T>::ForEachFile(const std::filesystem::path& path, auto&& F) -> void {
+    const auto stem{path.stem().string()};
+    const auto extension{path.extension().string()};
+    const auto directory{path.has_parent_path() ? path.parent_path() : "."};
+    const auto IsJournal{[&](const std::string& name) {
+        if (name == stem + extension) {
+            return true;
+        }
+        const auto prefix{stem + "_mpi"};
+        if (not name.starts_with(prefix) or not name.ends_with(extension) or
+            name.size() <= prefix.size() + extension.size()) {
+            return false;
+        }
+        const auto rank{std::string_view{name}.substr(prefix.size(), name.size() - prefix.size() - extension.size())};
+        return std::ranges::all_of(rank, [](char c) { return '0' <= c and c <= '9'; });
+    }};
+    // collected first, since F may remove them
+    std::error_code error;
+    std::vector<std::filesystem::path> file;
+    for (auto&& entry : std::filesystem::directory_iterator{directory, error}) {
+        if (entry.is_regular_file() and IsJournal(entry.path().filename().string())) {
+            file.emplace_back(entry.path());
+        }
+    }
+    std::ranges::for_each(file, F);
+}
+
+template<std::integral T>
+auto TaskJournal<T>::Insert(IntervalSet& set, T taskID) -> void {
+    // fast path: extend the interval ending at taskID
+    const auto next{set.upper_bound(taskID)};
+    if (next != set.begin()) {
+        const auto previous{std::prev(next)};
+        if (previous->second > taskID) {
+            return;
+        }
+        if (previous->second == taskID) {
+            ++previous->second;
+            if (next != set.end() and next->first == previous->second) {
+                previous->second = next->second;
+                set.erase(next);
+            }
+            return;
+        }
+    }
+    Insert(set, taskID, static_cast<T>(taskID + 1));
+}
+
+template<std::integral T>
+auto TaskJournal<T>::Insert(IntervalSet& set, T first, T last) -> void {
+    if (first >= last) {
+        return;
+    }
+    auto it{set.upper_bound(first)};
+    if (it != set.begin() and std::prev(it)->second >= first) {
+        --it;
+        first = it->first;
+        last = std::max(last, it->second);
+        it = set.erase(it);
+    }
+    while (it != set.end() and it->first <= last) {
+        last = std::max(last, it->second);
+        it = set.erase(it);
+    }
+    set.emplace_hint(it, first, last);
+}
+
+template<std::integral T>
+auto TaskJournal<T>::Contains(const IntervalSet& set, T taskID) -> bool {
+    const auto next{set.upper_bound(taskID)};
+    return next != set.begin() and std::prev(next)->second > taskID;
+}
+
+} // namespace Mustard::inline Execution::internal
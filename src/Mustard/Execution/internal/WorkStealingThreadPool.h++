@@ -0,0 +1,121 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Utility/NonCopyableBase.h++"
+
+#include "gsl/gsl"
+
+#include <atomic>
+#include <concepts>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Mustard::inline Execution::internal {
+
+template<std::integral T, std::invocable<T> AFunction>
+class WorkStealingThreadPool;
+
+/// @brief Index of the pool thread running the calling task, 0 outside a pool.
+class WorkerID final {
+public:
+    static auto This() -> int { return fgThis; }
+
+private:
+    template<std::integral T, std::invocable<T> AFunction>
+    friend class WorkStealingThreadPool;
+
+    static thread_local inline int fgThis{};
+};
+
+/// @brief Rank-local thread pool executing task IDs submitted by a single producer.
+///
+/// The producer (the thread driving the MPI scheduler) submits task IDs one by
+/// one. Consecutive IDs are packed into ranges and distributed round-robin to
+/// per-thread queues. An idle thread steals half of the last range of another
+/// thread. The number of submitted but unfinished tasks is bounded, so that a
+/// rank does not hoard tasks that other ranks could execute.
+///
+/// ThreadInit, if set, is called with the thread index at the start of each thread,
+/// e.g. to pin it to a CPU.
+///
+/// @tparam T Task index type
+/// @tparam AFunction Task function type, invoked concurrently from all threads
+template<std::integral T, std::invocable<T> AFunction>
+class WorkStealingThreadPool final : public NonCopyableBase {
+public:
+    WorkStealingThreadPool(int nThread, AFunction& function, std::function<auto(int)->void> ThreadInit = {});
+    ~WorkStealingThreadPool();
+
+    auto Submit(T taskID) -> void;
+    /// @brief Wait for all submitted tasks. Rethrows the first exception thrown by a task.
+    auto Join() -> void;
+
+private:
+    struct TaskRange {
+        T first;
+        T last;
+    };
+
+    struct alignas(64) Worker {
+        std::mutex mutex;
+        std::deque<TaskRange> queue;
+    };
+
+private:
+    auto Flush() -> void;
+    auto Stop() -> void;
+    auto WorkerLoop(int id) -> void;
+    auto Pop(int id) -> std::optional<T>;
+    auto Steal(int thief) -> std::optional<TaskRange>;
+
+private:
+    AFunction& fFunction;
+    std::function<auto(int)->void> fThreadInit;
+    int fNThread;
+    long long fInFlightLimit;
+
+    std::unique_ptr<Worker[]> fWorker;
+    TaskRange fPending;
+    int fNextWorker;
+
+    alignas(64) std::atomic<long long> fNInFlight;
+    alignas(64) std::atomic<unsigned> fGeneration;
+    std::atomic<int> fNIdleThread;
+    std::atomic<bool> fSubmitDone;
+    std::atomic<bool> fAborted;
+    std::mutex fExceptionMutex;
+    std::exception_ptr fException;
+
+    std::vector<std::jthread> fThread;
+
+    static constexpr T fgChunkSize{4};
+    static constexpr long long fgInFlightTaskPerThread{8};
+};
+
+} // namespace Mustard::inline Execution::internal
+
+#include "Mustard/Execution/internal/WorkStealingThreadPool.inl"
@@ -0,0 +1,195 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::inline Execution::internal {
+
+template<std::integral T, std::invocable<T> AFunction>
+WorkStealingThreadPool<T, AFunction>::WorkStealingThreadPool(int nThread, AFunction& function, std::function<auto(int)->void> ThreadInit) :
+    NonCopyableBase{},
+    fFunction{function},
+    fThreadInit{std::move(ThreadInit)},
+    fNThread{nThread},
+    fInFlightLimit{fgInFlightTaskPerThread * nThread},
+    fWorker{std::make_unique<Worker[]>(nThread)},
+    fPending{},
+    fNextWorker{},
+    fNInFlight{},
+    fGeneration{},
+    fNIdleThread{},
+    fSubmitDone{},
+    fAborted{},
+    fExceptionMutex{},
+    fException{},
+    fThread{} {
+    Expects(nThread >= 1);
+    fThread.reserve(nThread);
+    for (int id{}; id < nThread; ++id) {
+        fThread.emplace_back([this, id] { WorkerLoop(id); });
+    }
+}
+
+template<std::integral T, std::invocable<T> AFunction>
+WorkStealingThreadPool<T, AFunction>::~WorkStealingThreadPool() {
+    Stop();
+}
+
+template<std::integral T, std::invocable<T> AFunction>
+auto WorkStealingThreadPool<T, AFunction>::Submit(T taskID) -> void {
+    if (fPending.last == taskID and fPending.last != fPending.first) [[likely]] {
+        ++fPending.last;
+    } else {
+        Flush();
+        fPending = {taskID, static_cast<T>(taskID + 1)};
+    }
+    if (fPending.last - fPending.first == fgChunkSize) {
+        Flush();
+    }
+}
+
+template<std::integral T, std::invocable<T> AFunction>
+auto WorkStealingThreadPool<T, AFunction>::Join() -> void {
+    Stop();
+    if (fException) {
+        std::rethrow_exception(std::exchange(fException, nullptr));
+    }
+}
+
+template<std::integral T, std::invocable<T> AFunction>
+auto WorkStealingThreadPool<T, AFunction>::Flush() -> void {
+    if (fPending.first == fPending.last) {
+        return;
+    }
+    // throttle: wait for workers to drain the in-flight tasks
+    for (auto nInFlight{fNInFlight.load(std::memory_order::acquire)};
+         nInFlight >= fInFlightLimit;
+         nInFlight = fNInFlight.load(std::memory_order::acquire)) {
+        fNInFlight.wait(nInFlight, std::memory_order::acquire);
+    }
+    auto& worker{fWorker[fNextWorker]};
+    {
+        const std::scoped_lock lock{worker.mutex};
+        worker.queue.push_back(fPending);
+    }
+    fNInFlight.fetch_add(fPending.last - fPending.first, std::memory_order::release);
+    fPending = {};
+    fNextWorker = (fNextWorker + 1) % fNThread;
+    fGeneration.fetch_add(1, std::memory_order::seq_cst);
+    if (fNIdleThread.load(std::memory_order::seq_cst) > 0) {
+        fGeneration.notify_all();
+    }
+}
+
+template<std::integral T, std::invocable<T> AFunction>
+auto WorkStealingThreadPool<T, AFunction>::Stop() -> void {
+    if (fSubmitDone.load(std::memory_order::relaxed)) {
+        return;
+    }
+    Flush();
+    fSubmitDone.store(true, std::memory_order::release);
+    fGeneration.fetch_add(1, std::memory_order::release);
+    fGeneration.notify_all();
+    for (auto&& thread : fThread) {
+        thread.join();
+    }
+}
+
+template<std::integral T, std::invocable<T> AFunction>
+auto WorkStealingThreadPool<T, AFunction>::WorkerLoop(int id) -> void {
+    WorkerID::fgThis = id;
+    if (fThreadInit) {
+        fThreadInit(id);
+    }
+    while (true) {
+        const auto generation{fGeneration.load(std::memory_order::acquire)};
+        // once submission is done, all submitted tasks are visible to Pop
+        const auto submitDone{fSubmitDone.load(std::memory_order::acquire)};
+        if (const auto taskID{Pop(id)}) {
+            if (not fAborted.load(std::memory_order::relaxed)) [[likely]] {
+                try {
+                    std::invoke(fFunction, *taskID);
+                } catch (...) {
+                    const std::scoped_lock lock{fExceptionMutex};
+                    if (not fException) {
+                        fException = std::current_exception();
+                    }
+                    fAborted.store(true, std::memory_order::relaxed);
+                }
+            }
+            if (fNInFlight.fetch_sub(1, std::memory_order::acq_rel) == fInFlightLimit) {
+                fNInFlight.notify_one();
+            }
+            continue;
+        }
+        if (submitDone) {
+            break;
+        }
+        fNIdleThread.fetch_add(1, std::memory_order::seq_cst);
+        fGeneration.wait(generation, std::memory_order::seq_cst);
+        fNIdleThread.fetch_sub(1, std::memory_order::relaxed);
+    }
+}
+
+template<std::integral T, std::invocable<T> AFunction>
+auto WorkStealingThreadPool<T, AFunction>::Pop(int id) -> std::optional<T> {
+    auto& worker{fWorker[id]};
+    {
+        const std::scoped_lock lock{worker.mutex};
+        if (not worker.queue.empty()) {
+            auto& range{worker.queue.front()};
+            const auto taskID{range.first++};
+            if (range.first == range.last) {
+                worker.queue.pop_front();
+            }
+            return taskID;
+        }
+    }
+    auto stolen{Steal(id)};
+    if (not stolen) {
+        return std::nullopt;
+    }
+    const auto taskID{stolen->first++};
+    if (stolen->first != stolen->last) {
+        const std::scoped_lock lock{worker.mutex};
+        worker.queue.push_back(*stolen);
+    }
+    return taskID;
+}
+
+template<std::integral T, std::invocable<T> AFunction>
+auto WorkStealingThreadPool<T, AFunction>::Steal(int thief) -> std::optional<TaskRange> {
+    for (int i{1}; i < fNThread; ++i) {
+        auto& victim{fWorker[(thief + i) % fNThread]};
+        const std::scoped_lock lock{victim.mutex};
+        if (victim.queue.empty()) {
+            continue;
+        }
+        auto& range{victim.queue.back()};
+        if (range.last - range.first == 1) {
+            const auto stolen{range};
+            victim.queue.pop_back();
+            return stolen;
+        }
+        const auto middle{static_cast<T>(range.first + (range.last - range.first) / 2)};
+        const TaskRange stolen{middle, range.last};
+        range.last = middle;
+        return stolen;
+    }
+    return std::nullopt;
+}
+
+} // namespace Mustard::inline Execution::internal
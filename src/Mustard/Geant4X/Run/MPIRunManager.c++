@@ -21,6 +21,8 @@
 #include "Mustard/IO/PrettyLog.h++"
 #include "Mustard/Parallel/ReseedRandomEngine.h++"
 
+#include "CLHEP/Random/Random.h"
+
 #include "G4Run.hh"
 
 #include "mplr/mplr.hpp"
@@ -29,7 +31,9 @@
 
 #include "fmt/core.h"
 
+#include <cstdint>
 #include <exception>
+#include <stdexcept>
 #include <streambuf>
 
 namespace Mustard::Geant4X::inline Run {
@@ -51,9 +55,14 @@ MPIRunManager::MPIRunManager() :
     G4RunManager{},
     internal::PostG4RunManagerInitFlipG4cout{},
     fExecutor{"G4Run", "G4Event"},
+    fJournal{},
+    fReproducibleRandom{},
+    fRandomSeed{},
     fMessengerRegister{this} {
     printModulo = -1;
     SetVerboseLevel(muc::to_underlying(Env::BasicEnv::Instance().VerboseLevel()));
+    // events are processed by a sequential G4RunManager
+    fExecutor.NThread(1);
 }
 
 auto MPIRunManager::PrintProgress(G4bool print) -> void {
@@ -66,8 +75,24 @@ auto MPIRunManager::PrintProgressInterval(muc::chrono::seconds<double> t) -> voi
     printModulo = -1;
 }
 
+auto MPIRunManager::ReproducibleRandom(bool a) -> void {
+    fReproducibleRandom = a;
+    fRandomSeed.reset();
+}
+
 auto MPIRunManager::BeamOn(G4int nEvent, gsl::czstring macroFile, G4int nSelect) -> void {
-    Parallel::ReseedRandomEngine();
+    if (not fReproducibleRandom) {
+        Parallel::ReseedRandomEngine();
+    } else if (not fRandomSeed) {
+        const auto worldComm{mplr::comm_world()};
+        std::uint64_t seed{};
+        if (worldComm.rank() == 0) {
+            const auto engine{CLHEP::HepRandom::getTheEngine()};
+            seed = static_cast<std::uint64_t>(engine->operator unsigned int()) << 32 | engine->operator unsigned int();
+        }
+        worldComm.bcast(0, seed);
+        fRandomSeed = seed;
+    }
     G4RunManager::BeamOn(nEvent, macroFile, nSelect);
 }
 
@@ -77,6 +102,26 @@ auto MPIRunManager::DoEventLoop(G4int nEvent, gsl::czstring macroFile, G4int nSe
     if (currentRun) {
         fExecutor.ExecutionName(fmt::format("G4Run {}", currentRun->GetRunID()));
     }
+    // One journal per run, a restarted job skips events already processed
+    if (not fJournal.empty() and currentRun) {
+        auto journal{fJournal};
+        journal.replace_filename(fmt::format("{}_run{}{}", fJournal.stem().string(), currentRun->GetRunID(), fJournal.extension().string()));
+        fExecutor.Journal(std::move(journal));
+    } else {
+        fExecutor.Journal({});
+    }
+    // Per-event random stream
+    if (fReproducibleRandom and currentRun) {
+        // the hook reseeds the process-wide engines
+        if (fExecutor.NThread() != 1) {
+            Throw<std::logic_error>("Reproducible random requires a single-thread event loop");
+        }
+        fExecutor.PreTaskHook([seed = *fRandomSeed, run = static_cast<std::uint64_t>(currentRun->GetRunID())](auto eventID) {
+            Parallel::ReseedRandomEngineForTask(seed, run, eventID);
+        });
+    } else {
+        fExecutor.PreTaskHook({});
+    }
     // Event loop
     fExecutor(numberOfEventToBeProcessed, [this](auto eventID) {
         ProcessOneEvent(eventID);
@@ -28,6 +28,11 @@
 
 #include "gsl/gsl"
 
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <utility>
+
 namespace Mustard::Geant4X::inline Run {
 
 namespace internal {
@@ -54,6 +59,12 @@ public:
 
     auto PrintProgress(G4bool print) -> void;
     auto PrintProgressInterval(muc::chrono::seconds<double> t) -> void;
+    auto Journal(std::filesystem::path path) -> void { fJournal = std::move(path); }
+    auto JournalInterval(muc::chrono::seconds<double> t) -> void { fExecutor.JournalInterval(t); }
+    /// @brief Give each event its own random stream keyed by (seed, run ID, event ID),
+    /// so that results do not depend on the number of processes or the scheduler.
+    /// The seed is drawn from the random engine of rank 0 at the next BeamOn.
+    auto ReproducibleRandom(bool a) -> void;
 
     virtual auto BeamOn(G4int nEvent, gsl::czstring macroFile = nullptr, G4int nSelect = -1) -> void override;
     virtual auto DoEventLoop(G4int nEvent, gsl::czstring macroFile, G4int nSelect) -> void override;
@@ -62,6 +73,9 @@ public:
 
 private:
     Executor<G4int> fExecutor;
+    std::filesystem::path fJournal;
+    bool fReproducibleRandom;
+    std::optional<std::uint64_t> fRandomSeed;
 
     MPIRunMessenger::Register<MPIRunManager> fMessengerRegister;
 };
@@ -22,6 +22,7 @@
 #include "G4SystemOfUnits.hh"
 #include "G4UIcmdWithABool.hh"
 #include "G4UIcmdWithADoubleAndUnit.hh"
+#include "G4UIcmdWithAString.hh"
 #include "G4UIcmdWithoutParameter.hh"
 #include "G4UIdirectory.hh"
 
@@ -34,7 +35,10 @@ MPIRunMessenger::MPIRunMessenger() :
     fDirectory{},
     fPrintProgress{},
     fPrintProgressInterval{},
-    fPrintRunSummary{} {
+    fPrintRunSummary{},
+    fJournal{},
+    fJournalInterval{},
+    fReproducibleRandom{} {
 
     fDirectory = std::make_unique<G4UIdirectory>("/Mustard/Run/");
     fDirectory->SetGuidance("Specialized settings for MPIRunManager.");
@@ -54,6 +58,29 @@ MPIRunMessenger::MPIRunMessenger() :
     fPrintRunSummary = std::make_unique<G4UIcmdWithoutParameter>("/Mustard/Run/PrintRunSummary", this);
     fPrintRunSummary->SetGuidance("Print MPI run performace summary.");
     fPrintRunSummary->AvailableForStates(G4State_Idle);
+
+    fJournal = std::make_unique<G4UIcmdWithAString>("/Mustard/Run/Journal", this);
+    fJournal->SetGuidance("Set path of the event loop journal, one file per run and process. "
+                          "A restarted job with the same path skips events already processed and restores the random engine. "
+                          "Empty to disable.");
+    fJournal->SetParameterName("path", true);
+    fJournal->SetDefaultValue("");
+    fJournal->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fJournalInterval = std::make_unique<G4UIcmdWithADoubleAndUnit>("/Mustard/Run/JournalInterval", this);
+    fJournalInterval->SetGuidance("Set time interval of writing the event loop journal.");
+    fJournalInterval->SetParameterName("interval", false);
+    fJournalInterval->SetUnitCategory("Time");
+    fJournalInterval->SetRange("interval >= 0");
+    fJournalInterval->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fReproducibleRandom = std::make_unique<G4UIcmdWithABool>("/Mustard/Run/ReproducibleRandom", this);
+    fReproducibleRandom->SetGuidance("Set whether each event has its own random stream keyed by (seed, run ID, event ID), "
+                                     "so that results do not depend on the number of processes or the scheduler. "
+                                     "The seed is drawn from the random engine of rank 0 at the next BeamOn. "
+                                     "Reseeding is O(1) with the Philox4x64 engine.");
+    fReproducibleRandom->SetParameterName("b", false);
+    fReproducibleRandom->AvailableForStates(G4State_PreInit, G4State_Idle);
 }
 
 MPIRunMessenger::~MPIRunMessenger() = default;
@@ -72,6 +99,19 @@ auto MPIRunMessenger::SetNewValue(G4UIcommand* command, G4String value) -> void
         Deliver<MPIRunManager>([&](auto&& r) {
             r.PrintRunSummary();
         });
+    } else if (command == fJournal.get()) {
+        Deliver<MPIRunManager>([&](auto&& r) {
+            r.Journal(std::string{value});
+        });
+    } else if (command == fJournalInterval.get()) {
+        Deliver<MPIRunManager>([&](auto&& r) {
+            const muc::chrono::seconds<double> interval{fJournalInterval->GetNewDoubleValue(value) / s};
+            r.JournalInterval(interval);
+        });
+    } else if (command == fReproducibleRandom.get()) {
+        Deliver<MPIRunManager>([&](auto&& r) {
+            r.ReproducibleRandom(fReproducibleRandom->GetNewBoolValue(value));
+        });
     }
 }
 
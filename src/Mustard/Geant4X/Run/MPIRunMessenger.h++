@@ -24,6 +24,7 @@
 
 class G4UIcmdWithABool;
 class G4UIcmdWithADoubleAndUnit;
+class G4UIcmdWithAString;
 class G4UIcmdWithoutParameter;
 class G4UIdirectory;
 
@@ -47,6 +48,9 @@ private:
     std::unique_ptr<G4UIcmdWithABool> fPrintProgress;
     std::unique_ptr<G4UIcmdWithADoubleAndUnit> fPrintProgressInterval;
     std::unique_ptr<G4UIcmdWithoutParameter> fPrintRunSummary;
+    std::unique_ptr<G4UIcmdWithAString> fJournal;
+    std::unique_ptr<G4UIcmdWithADoubleAndUnit> fJournalInterval;
+    std::unique_ptr<G4UIcmdWithABool> fReproducibleRandom;
 };
 
 } // namespace Mustard::Geant4X::inline Run
@@ -0,0 +1,72 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Math/Random/RandomNumberDistribution.h++"
+#include "Mustard/Utility/FunctionAttribute.h++"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <utility>
+
+namespace Mustard::Math::Random {
+
+/// @brief Serves random numbers of a distribution one by one from a buffer
+/// refilled by its Generate, so that scalar callers benefit from batch
+/// kernels.
+/// @note The buffer is refilled from the generator passed to the call that
+/// finds it empty, so use one buffered distribution per generator. Numbers
+/// left in the buffer are discarded on Reset or parameter change.
+/// @tparam ADistribution The distribution.
+/// @tparam NBuffer The buffer size.
+template<RandomNumberDistribution ADistribution, std::size_t NBuffer = 256>
+    requires(NBuffer > 0)
+class BufferedDistribution final {
+public:
+    using DistributionType = ADistribution;
+    using ResultType = typename ADistribution::ResultType;
+    using ParameterType = typename ADistribution::ParameterType;
+
+public:
+    template<typename... Args>
+        requires std::constructible_from<ADistribution, Args...>
+    constexpr explicit BufferedDistribution(Args&&... args);
+
+    constexpr auto Reset() -> void;
+
+    constexpr auto Distribution() const -> const auto& { return fDistribution; }
+    constexpr auto Parameter() const -> auto { return fDistribution.param(); }
+
+    constexpr auto Parameter(const ParameterType& p) -> void;
+
+    MUSTARD_ALWAYS_INLINE constexpr auto operator()(auto& g) -> ResultType;
+
+private:
+    constexpr auto Refill(auto& g) -> void;
+
+private:
+    ADistribution fDistribution;
+    std::array<ResultType, NBuffer> fBuffer;
+    std::size_t fIndex;
+};
+
+} // namespace Mustard::Math::Random
+
+#include "Mustard/Math/Random/BufferedDistribution.inl"
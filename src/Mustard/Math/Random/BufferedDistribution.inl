@@ -0,0 +1,60 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Math::Random {
+
+template<RandomNumberDistribution ADistribution, std::size_t NBuffer>
+    requires(NBuffer > 0)
+template<typename... Args>
+    requires std::constructible_from<ADistribution, Args...>
+constexpr BufferedDistribution<ADistribution, NBuffer>::BufferedDistribution(Args&&... args) :
+    fDistribution(std::forward<Args>(args)...),
+    fBuffer{},
+    fIndex{NBuffer} {}
+
+template<RandomNumberDistribution ADistribution, std::size_t NBuffer>
+    requires(NBuffer > 0)
+constexpr auto BufferedDistribution<ADistribution, NBuffer>::Reset() -> void {
+    fDistribution.reset();
+    fIndex = NBuffer;
+}
+
+template<RandomNumberDistribution ADistribution, std::size_t NBuffer>
+    requires(NBuffer > 0)
+constexpr auto BufferedDistribution<ADistribution, NBuffer>::Parameter(const ParameterType& p) -> void {
+    fDistribution.param(p);
+    fIndex = NBuffer;
+}
+
+template<RandomNumberDistribution ADistribution, std::size_t NBuffer>
+    requires(NBuffer > 0)
+MUSTARD_ALWAYS_INLINE constexpr auto BufferedDistribution<ADistribution, NBuffer>::operator()(auto& g) -> ResultType {
+    if (fIndex == NBuffer) [[unlikely]] {
+        Refill(g);
+    }
+    return fBuffer[fIndex++];
+}
+
+template<RandomNumberDistribution ADistribution, std::size_t NBuffer>
+    requires(NBuffer > 0)
+constexpr auto BufferedDistribution<ADistribution, NBuffer>::Refill(auto& g) -> void {
+    fDistribution.Generate(g, fBuffer);
+    fIndex = 0;
+}
+
+} // namespace Mustard::Math::Random
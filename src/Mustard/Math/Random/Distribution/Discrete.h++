@@ -0,0 +1,129 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Math/Random/Distribution/Uniform.h++"
+#include "Mustard/Math/Random/Distribution/internal/AliasTable.h++"
+#include "Mustard/Math/Random/RandomNumberDistributionBase.h++"
+#include "Mustard/Utility/FunctionAttribute.h++"
+
+#include "CLHEP/Random/RandomEngine.h"
+
+#include "TH1.h"
+
+#include "muc/concepts"
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace Mustard::Math::Random::inline Distribution {
+
+/// @brief Generates random integers in [0, n) with given weights, by Walker's
+/// alias method. Building takes O(n) and sampling takes O(1) regardless of n.
+/// @tparam T The type of the result.
+/// @tparam NMax The maximum number of weights, beyond which construction throws
+/// std::length_error (e.g. a TH1 of more than NMax bins). The parameter is
+/// stored inline, as distributions must be trivially copyable, so it takes
+/// 12 * NMax bytes (12 KiB by default). Prefer passing it by reference.
+template<std::integral T = int, std::size_t NMax = 1024>
+class Discrete;
+
+namespace internal {
+
+template<std::integral T, std::size_t NMax>
+class BasicDiscreteParameter final : public DistributionParameterBase<BasicDiscreteParameter<T, NMax>,
+                                                                      Discrete<T, NMax>> {
+private:
+    using Base = DistributionParameterBase<BasicDiscreteParameter<T, NMax>,
+                                           Discrete<T, NMax>>;
+
+public:
+    /// @brief Always 0.
+    constexpr BasicDiscreteParameter();
+    /// @brief From non-negative weights, not all zero.
+    explicit BasicDiscreteParameter(std::span<const double> weight);
+    /// @brief From bin contents of a 1D histogram. Bin i (1 <= i <= N) maps to
+    /// i - 1. Under- and overflow are ignored.
+    explicit BasicDiscreteParameter(const TH1& histogram);
+
+    constexpr auto Size() const -> std::size_t { return fTable.Size(); }
+    constexpr auto Table() const -> const auto& { return fTable; }
+
+    template<muc::character AChar>
+    friend auto operator<<(std::basic_ostream<AChar>& os, const BasicDiscreteParameter& self) -> decltype(os) { return os << self.fTable; }
+    template<muc::character AChar>
+    friend auto operator>>(std::basic_istream<AChar>& is, BasicDiscreteParameter& self) -> decltype(is) { return is >> self.fTable; }
+
+private:
+    AliasTable<NMax> fTable;
+};
+
+} // namespace internal
+
+template<std::integral T, std::size_t NMax>
+using DiscreteParameter = internal::BasicDiscreteParameter<T, NMax>;
+
+template<std::integral T, std::size_t NMax>
+class Discrete final : public RandomNumberDistributionBase<Discrete<T, NMax>,
+                                                           DiscreteParameter<T, NMax>,
+                                                           T> {
+private:
+    using Base = RandomNumberDistributionBase<Discrete<T, NMax>,
+                                              DiscreteParameter<T, NMax>,
+                                              T>;
+
+public:
+    constexpr Discrete() = default;
+    explicit Discrete(std::span<const double> weight);
+    explicit Discrete(const TH1& histogram);
+    constexpr explicit Discrete(const DiscreteParameter<T, NMax>& p);
+
+    constexpr auto Reset() -> void {}
+
+    constexpr auto Parameter() const -> const auto& { return fParameter; }
+    constexpr auto Parameter(const DiscreteParameter<T, NMax>& p) -> void { fParameter = p; }
+
+    constexpr auto Min() const -> T { return 0; }
+    constexpr auto Max() const -> T { return static_cast<T>(fParameter.Size() - 1); }
+
+    static constexpr auto Stateless() -> bool { return true; }
+
+    MUSTARD_ALWAYS_INLINE constexpr auto operator()(UniformRandomBitGenerator auto& g) -> auto { return Impl(g, fParameter); }
+    MUSTARD_ALWAYS_INLINE constexpr auto operator()(UniformRandomBitGenerator auto& g, const DiscreteParameter<T, NMax>& p) -> auto { return Impl(g, p); }
+
+    MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g) -> auto { return Impl(g, fParameter); }
+    MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g, const DiscreteParameter<T, NMax>& p) -> auto { return Impl(g, p); }
+
+    template<muc::character AChar>
+    friend auto operator<<(std::basic_ostream<AChar>& os, const Discrete& self) -> auto& { return os << self.fParameter; }
+    template<muc::character AChar>
+    friend auto operator>>(std::basic_istream<AChar>& is, Discrete& self) -> auto& { return is >> self.fParameter; }
+
+private:
+    MUSTARD_ALWAYS_INLINE static constexpr auto Impl(auto& g, const DiscreteParameter<T, NMax>& p) -> T;
+
+private:
+    DiscreteParameter<T, NMax> fParameter;
+};
+
+} // namespace Mustard::Math::Random::inline Distribution
+
+#include "Mustard/Math/Random/Distribution/Discrete.inl"
@@ -0,0 +1,67 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Math::Random::inline Distribution {
+
+namespace internal {
+
+template<std::integral T, std::size_t NMax>
+constexpr BasicDiscreteParameter<T, NMax>::BasicDiscreteParameter() :
+    Base{},
+    fTable{} {}
+
+template<std::integral T, std::size_t NMax>
+BasicDiscreteParameter<T, NMax>::BasicDiscreteParameter(std::span<const double> weight) :
+    Base{},
+    fTable{weight} {}
+
+template<std::integral T, std::size_t NMax>
+BasicDiscreteParameter<T, NMax>::BasicDiscreteParameter(const TH1& histogram) :
+    BasicDiscreteParameter{[&histogram] {
+        std::vector<double> weight;
+        weight.reserve(histogram.GetNbinsX());
+        for (int i{1}; i <= histogram.GetNbinsX(); ++i) {
+            weight.emplace_back(histogram.GetBinContent(i));
+        }
+        return weight;
+    }()} {}
+
+} // namespace internal
+
+template<std::integral T, std::size_t NMax>
+Discrete<T, NMax>::Discrete(std::span<const double> weight) :
+    Base{},
+    fParameter{weight} {}
+
+template<std::integral T, std::size_t NMax>
+Discrete<T, NMax>::Discrete(const TH1& histogram) :
+    Base{},
+    fParameter{histogram} {}
+
+template<std::integral T, std::size_t NMax>
+constexpr Discrete<T, NMax>::Discrete(const DiscreteParameter<T, NMax>& p) :
+    Base{},
+    fParameter{p} {}
+
+template<std::integral T, std::size_t NMax>
+MUSTARD_ALWAYS_INLINE constexpr auto Discrete<T, NMax>::Impl(auto& g, const DiscreteParameter<T, NMax>& p) -> T {
+    static_assert(Uniform<double>::Stateless());
+    return p.Table()(Uniform<double>{}(g));
+}
+
+} // namespace Mustard::Math::Random::inline Distribution
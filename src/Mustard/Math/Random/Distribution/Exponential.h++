@@ -19,8 +19,11 @@
 #pragma once
 
 #include "Mustard/Math/Random/Distribution/Uniform.h++"
+#include "Mustard/Math/Random/Distribution/internal/Ziggurat.h++"
 #include "Mustard/Math/Random/RandomNumberDistributionBase.h++"
+#include "Mustard/Math/internal/ConstexprMath.h++"
 #include "Mustard/Math/internal/FastLogOn01.h++"
+#include "Mustard/Math/internal/LogOn01.h++"
 #include "Mustard/Utility/FunctionAttribute.h++"
 
 #include "CLHEP/Random/RandomEngine.h"
@@ -31,6 +34,7 @@
 #include <concepts>
 #include <iomanip>
 #include <limits>
+#include <span>
 
 namespace Mustard::Math::Random::inline Distribution {
 
@@ -127,6 +131,11 @@ public:
     MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g) -> auto { return Impl(g, this->fParameter); }
     MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g, const ExponentialParameter<T>& p) -> auto { return Impl(g, p); }
 
+    /// @brief Fill with random numbers of the distribution, by a vectorizable
+    /// kernel over a batch of uniform random numbers.
+    auto Generate(auto& g, std::span<T> out) -> void { Generate(g, out, this->fParameter); }
+    auto Generate(auto& g, std::span<T> out, const ExponentialParameter<T>& p) -> void;
+
 private:
     MUSTARD_ALWAYS_INLINE static auto Impl(auto& g, const ExponentialParameter<T>& p) -> T;
 };
@@ -159,6 +168,11 @@ public:
     MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g) -> auto { return Impl(g, this->fParameter); }
     MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g, const ExponentialFastParameter<T>& p) -> auto { return Impl(g, p); }
 
+    /// @brief Fill with random numbers of the distribution, by a vectorizable
+    /// kernel over a batch of uniform random numbers.
+    auto Generate(auto& g, std::span<T> out) -> void { Generate(g, out, this->fParameter); }
+    auto Generate(auto& g, std::span<T> out, const ExponentialFastParameter<T>& p) -> void;
+
 private:
     MUSTARD_ALWAYS_INLINE static constexpr auto Impl(auto& g, const ExponentialFastParameter<T>& p) -> T;
 };
@@ -166,6 +180,42 @@ private:
 template<typename T>
 ExponentialFast(T) -> ExponentialFast<T>;
 
+/// @brief Generates random floating-points of exponential distribution, by
+/// the ziggurat method with 256 layers. Most samples cost one draw, one table
+/// lookup and one comparison, without any log.
+/// @note Reference: G. Marsaglia and W. W. Tsang, The Ziggurat Method for
+/// Generating Random Variables, J. Stat. Softw. 5 (2000).
+/// @tparam T The type of the result.
+template<std::floating_point T = double>
+class ExponentialZiggurat;
+
+template<std::floating_point T>
+using ExponentialZigguratParameter = internal::BasicExponentialParameter<T, ExponentialZiggurat>;
+
+template<std::floating_point T>
+class ExponentialZiggurat final : public internal::ExponentialBase<ExponentialZiggurat, T> {
+public:
+    using internal::ExponentialBase<ExponentialZiggurat, T>::ExponentialBase;
+
+    MUSTARD_ALWAYS_INLINE constexpr auto operator()(UniformRandomBitGenerator auto& g) -> auto { return Impl(g, this->fParameter); }
+    MUSTARD_ALWAYS_INLINE constexpr auto operator()(UniformRandomBitGenerator auto& g, const ExponentialZigguratParameter<T>& p) -> auto { return Impl(g, p); }
+
+    MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g) -> auto { return Impl(g, this->fParameter); }
+    MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g, const ExponentialZigguratParameter<T>& p) -> auto { return Impl(g, p); }
+
+private:
+    MUSTARD_ALWAYS_INLINE static constexpr auto Impl(auto& g, const ExponentialZigguratParameter<T>& p) -> T;
+
+private:
+    static constexpr internal::Ziggurat<T, 256> fgZiggurat{
+        7.69711747013104972L, 3.9496598225815571993e-3L,
+        [](long double x) { return Math::internal::ConstexprExp(-x); },
+        [](long double y) { return -Math::internal::ConstexprLog(y); }};
+};
+
+template<typename T>
+ExponentialZiggurat(T) -> ExponentialZiggurat<T>;
+
 } // namespace Mustard::Math::Random::inline Distribution
 
 #include "Mustard/Math/Random/Distribution/Exponential.inl"
@@ -59,6 +59,12 @@ constexpr ExponentialBase<ADerived, T>::ExponentialBase(const typename Base::Par
     static_assert(Uniform<T>::Stateless());                                    \
     return -p.Expectation() * TheLog(Uniform<T>{}(g));
 
+#define MUSTARD_MATH_RANDOM_DISTRIBUTION_EXPONENTIAL_BATCH_SNIPPET(TheLog) \
+    Uniform<T>{}.Generate(g, out);                                         \
+    for (auto&& x : out) {                                                 \
+        x = -p.Expectation() * TheLog(x);                                  \
+    }
+
 template<std::floating_point T>
 MUSTARD_ALWAYS_INLINE auto Exponential<T>::Impl(auto& g, const ExponentialParameter<T>& p) -> T {
     MUSTARD_MATH_RANDOM_DISTRIBUTION_EXPONENTIAL_GENERATOR_SNIPPET(std::log)
@@ -69,4 +75,28 @@ MUSTARD_ALWAYS_INLINE constexpr auto ExponentialFast<T>::Impl(auto& g, const Exp
     MUSTARD_MATH_RANDOM_DISTRIBUTION_EXPONENTIAL_GENERATOR_SNIPPET(Math::internal::FastLogOn01)
 }
 
+template<std::floating_point T>
+auto Exponential<T>::Generate(auto& g, std::span<T> out, const ExponentialParameter<T>& p) -> void {
+    MUSTARD_MATH_RANDOM_DISTRIBUTION_EXPONENTIAL_BATCH_SNIPPET(Math::internal::LogOn01)
+}
+
+template<std::floating_point T>
+auto ExponentialFast<T>::Generate(auto& g, std::span<T> out, const ExponentialFastParameter<T>& p) -> void {
+    MUSTARD_MATH_RANDOM_DISTRIBUTION_EXPONENTIAL_BATCH_SNIPPET(Math::internal::FastLogOn01)
+}
+
+#undef MUSTARD_MATH_RANDOM_DISTRIBUTION_EXPONENTIAL_BATCH_SNIPPET
+
+template<std::floating_point T>
+MUSTARD_ALWAYS_INLINE constexpr auto ExponentialZiggurat<T>::Impl(auto& g, const ExponentialZigguratParameter<T>& p) -> T {
+    return p.Expectation() * fgZiggurat.template Sample<false>(
+                                 g,
+                                 [](T x) { return std::exp(-x); },
+                                 [](auto& engine, T) {
+                                     // memoryless
+                                     static_assert(Uniform<T>::Stateless());
+                                     return fgZiggurat.R() - std::log(Uniform<T>{}(engine));
+                                 });
+}
+
 } // namespace Mustard::Math::Random::inline Distribution
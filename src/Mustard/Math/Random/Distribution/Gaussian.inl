@@ -74,4 +74,61 @@ MUSTARD_ALWAYS_INLINE auto GaussianFast<T>::Impl(auto& g, const GaussianFastPara
 
 #undef MUSTARD_MATH_RANDOM_DISTRIBUTION_GAUSSIAN_GENERATOR_SNIPPET
 
+#define MUSTARD_MATH_RANDOM_DISTRIBUTION_GAUSSIAN_BATCH_SNIPPET(TheLog)          \
+    const auto n{out.size() / 2};                                                \
+    const auto u{out.first(n)};                                                  \
+    const auto v{out.subspan(n, n)};                                             \
+    Uniform<T>{}.Generate(g, out.first(2 * n));                                  \
+    for (auto&& x : u) {                                                         \
+        x = -2 * TheLog(x);                                                      \
+    }                                                                            \
+    /* separated, as sqrt is not vectorized if it may set errno */               \
+    for (auto&& x : u) {                                                         \
+        x = std::sqrt(x);                                                        \
+    }                                                                            \
+    for (std::size_t i{}; i < n; ++i) {                                          \
+        const auto r{u[i]};                                                      \
+        const auto [sin, cos]{Math::internal::SinCos2PiOn01(v[i])};              \
+        u[i] = p.Sigma() * (r * cos) + p.Mu();                                   \
+        v[i] = p.Sigma() * (r * sin) + p.Mu();                                   \
+    }                                                                            \
+    if (out.size() % 2 == 1) {                                                   \
+        static_assert(Uniform<T>::Stateless());                                  \
+        const auto r{std::sqrt(-2 * TheLog(Uniform<T>{}(g)))};                   \
+        const auto cos{Math::internal::SinCos2PiOn01(Uniform<T>{}(g)).second};   \
+        out.back() = p.Sigma() * (r * cos) + p.Mu();                             \
+    }
+
+template<std::floating_point T>
+auto Gaussian<T>::Generate(auto& g, std::span<T> out, const GaussianParameter<T>& p) -> void {
+    MUSTARD_MATH_RANDOM_DISTRIBUTION_GAUSSIAN_BATCH_SNIPPET(Math::internal::LogOn01)
+}
+
+template<std::floating_point T>
+auto GaussianFast<T>::Generate(auto& g, std::span<T> out, const GaussianFastParameter<T>& p) -> void {
+    MUSTARD_MATH_RANDOM_DISTRIBUTION_GAUSSIAN_BATCH_SNIPPET(Math::internal::FastLogOn01)
+}
+
+#undef MUSTARD_MATH_RANDOM_DISTRIBUTION_GAUSSIAN_BATCH_SNIPPET
+
+template<std::floating_point T>
+MUSTARD_ALWAYS_INLINE constexpr auto GaussianZiggurat<T>::Impl(auto& g, const GaussianZigguratParameter<T>& p) -> T {
+    const auto x{fgZiggurat.template Sample<true>(
+        g,
+        [](T x) { return std::exp(-x * x / 2); },
+        [](auto& engine, T u) {
+            // Marsaglia's tail method
+            static_assert(Uniform<T>::Stateless());
+            const auto r{fgZiggurat.R()};
+            T x;
+            T y;
+            do {
+                x = -std::log(Uniform<T>{}(engine)) / r;
+                y = -std::log(Uniform<T>{}(engine));
+            } while (2 * y < x * x);
+            return u < 0 ? -(r + x) : r + x;
+        })};
+    return p.Sigma() * x + p.Mu();
+}
+
 } // namespace Mustard::Math::Random::inline Distribution
@@ -120,7 +120,7 @@ public:
 
     constexpr auto Parameter() const -> AParameter;
     template<gsl::index I>
-    constexpr auto Parameter() const -> auto { return this->template Margin<I>().Parameter(); }
+    constexpr auto Parameter() const -> decltype(auto) { return this->template Margin<I>().Parameter(); }
 
     constexpr auto Parameter(const AParameter& p) -> void;
     template<gsl::index I>
@@ -155,7 +155,7 @@ template<typename T, typename... Ds>
 class JointParameter final : public JointParameterInterface<JointParameter<T, Ds...>,
                                                             Joint<T, Ds...>,
                                                             Ds...> {
-    using JointParameterInterface<Ds...>::JointParameterInterface;
+    using JointParameterInterface<JointParameter<T, Ds...>, Joint<T, Ds...>, Ds...>::JointParameterInterface;
 };
 
 template<typename... Ps>
@@ -167,7 +167,7 @@ class Joint final : public JointInterface<Joint<T, Ds...>,
                                           JointParameter<T, Ds...>,
                                           T,
                                           Ds...> {
-    using JointInterface<T, Ds...>::JointInterface;
+    using JointInterface<Joint<T, Ds...>, JointParameter<T, Ds...>, T, Ds...>::JointInterface;
 };
 
 template<typename... Ps>
@@ -0,0 +1,207 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/Math/Random/Distribution/Uniform.h++"
+#include "Mustard/Math/Random/Distribution/internal/AliasTable.h++"
+#include "Mustard/Math/Random/RandomNumberDistributionBase.h++"
+#include "Mustard/Utility/FunctionAttribute.h++"
+
+#include "CLHEP/Random/RandomEngine.h"
+
+#include "TH1.h"
+
+#include "muc/concepts"
+
+#include "fmt/core.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace Mustard::Math::Random::inline Distribution {
+
+/// @brief Generates random floating-points of a piecewise-constant density
+/// (a histogram). An interval is chosen by the alias method, then a uniform
+/// point inside it. Building takes O(n) and sampling takes O(1) regardless of n.
+/// @tparam T The type of the result.
+/// @tparam NMax The maximum number of intervals, beyond which construction
+/// throws std::length_error (e.g. a TH1 of more than NMax bins). The parameter
+/// is stored inline, as distributions must be trivially copyable, so it takes
+/// (12 + 2 * sizeof(T)) * NMax bytes (28 KiB by default for double). Prefer
+/// passing it by reference.
+template<std::floating_point T = double, std::size_t NMax = 1024>
+class PiecewiseConstant;
+
+/// @brief Generates random floating-points of a piecewise-linear density.
+/// An interval is chosen by the alias method, then the linear density inside
+/// it is inverted analytically. Building takes O(n) and sampling takes O(1)
+/// regardless of n.
+/// @tparam T The type of the result.
+/// @tparam NMax The maximum number of intervals, beyond which construction
+/// throws std::length_error (e.g. a TH1 of more than NMax bins). The parameter
+/// is stored inline, as distributions must be trivially copyable, so it takes
+/// (12 + 2 * sizeof(T)) * NMax bytes (28 KiB by default for double). Prefer
+/// passing it by reference.
+template<std::floating_point T = double, std::size_t NMax = 1024>
+class PiecewiseLinear;
+
+namespace internal {
+
+template<std::floating_point T, std::size_t NMax, bool ALinear>
+class BasicPiecewiseParameter final : public DistributionParameterBase<BasicPiecewiseParameter<T, NMax, ALinear>,
+                                                                       std::conditional_t<ALinear,
+                                                                                          PiecewiseLinear<T, NMax>,
+                                                                                          PiecewiseConstant<T, NMax>>> {
+private:
+    using Base = DistributionParameterBase<BasicPiecewiseParameter<T, NMax, ALinear>,
+                                           std::conditional_t<ALinear,
+                                                              PiecewiseLinear<T, NMax>,
+                                                              PiecewiseConstant<T, NMax>>>;
+
+public:
+    /// @brief Uniform on [0, 1).
+    constexpr BasicPiecewiseParameter();
+    /// @brief From interval boundaries (strictly increasing) and non-negative
+    /// densities. Piecewise-constant: one density per interval
+    /// (density.size() == x.size() - 1). Piecewise-linear: one density per
+    /// boundary (density.size() == x.size()). Densities need not be
+    /// normalized.
+    BasicPiecewiseParameter(std::span<const T> x, std::span<const T> density);
+    /// @brief From a 1D histogram, with density content / width.
+    /// Piecewise-constant: intervals are the bins. Piecewise-linear: nodes are
+    /// the bin centers, so the outer half bins are dropped. Under- and
+    /// overflow are ignored.
+    explicit BasicPiecewiseParameter(const TH1& histogram);
+
+    constexpr auto NInterval() const -> std::size_t { return fTable.Size(); }
+    constexpr auto X() const -> std::span<const T> { return {fX.data(), NInterval() + 1}; }
+    constexpr auto Density() const -> std::span<const T> { return {fDensity.data(), NInterval() + ALinear}; }
+    constexpr auto Table() const -> const auto& { return fTable; }
+
+    template<muc::character AChar>
+    friend auto operator<<(std::basic_ostream<AChar>& os, const BasicPiecewiseParameter& self) -> decltype(os) { return self.StreamOutput(os); }
+    template<muc::character AChar>
+    friend auto operator>>(std::basic_istream<AChar>& is, BasicPiecewiseParameter& self) -> decltype(is) { return self.StreamInput(is); }
+
+private:
+    template<muc::character AChar>
+    auto StreamOutput(std::basic_ostream<AChar>& os) const -> decltype(os);
+    template<muc::character AChar>
+    auto StreamInput(std::basic_istream<AChar>& is) & -> decltype(is);
+
+private:
+    std::array<T, NMax + 1> fX;
+    std::array<T, NMax + 1> fDensity;
+    AliasTable<NMax> fTable;
+};
+
+template<std::floating_point T, std::size_t NMax, bool ALinear>
+class PiecewiseBase : public RandomNumberDistributionBase<std::conditional_t<ALinear,
+                                                                             PiecewiseLinear<T, NMax>,
+                                                                             PiecewiseConstant<T, NMax>>,
+                                                          BasicPiecewiseParameter<T, NMax, ALinear>,
+                                                          T> {
+private:
+    using Base = RandomNumberDistributionBase<std::conditional_t<ALinear,
+                                                                 PiecewiseLinear<T, NMax>,
+                                                                 PiecewiseConstant<T, NMax>>,
+                                              BasicPiecewiseParameter<T, NMax, ALinear>,
+                                              T>;
+
+public:
+    constexpr PiecewiseBase() = default;
+    PiecewiseBase(std::span<const T> x, std::span<const T> density);
+    explicit PiecewiseBase(const TH1& histogram);
+    constexpr explicit PiecewiseBase(const typename Base::ParameterType& p);
+
+protected:
+    constexpr ~PiecewiseBase() = default;
+
+public:
+    constexpr auto Reset() -> void {}
+
+    constexpr auto Parameter() const -> const auto& { return fParameter; }
+    constexpr auto Parameter(const typename Base::ParameterType& p) -> void { fParameter = p; }
+
+    constexpr auto Min() const -> auto { return fParameter.X().front(); }
+    constexpr auto Max() const -> auto { return fParameter.X().back(); }
+
+    static constexpr auto Stateless() -> bool { return true; }
+
+    template<muc::character AChar>
+    friend auto operator<<(std::basic_ostream<AChar>& os, const PiecewiseBase& self) -> auto& { return os << self.fParameter; }
+    template<muc::character AChar>
+    friend auto operator>>(std::basic_istream<AChar>& is, PiecewiseBase& self) -> auto& { return is >> self.fParameter; }
+
+protected:
+    typename Base::ParameterType fParameter;
+};
+
+} // namespace internal
+
+template<std::floating_point T, std::size_t NMax>
+using PiecewiseConstantParameter = internal::BasicPiecewiseParameter<T, NMax, false>;
+
+template<std::floating_point T, std::size_t NMax>
+class PiecewiseConstant final : public internal::PiecewiseBase<T, NMax, false> {
+public:
+    using internal::PiecewiseBase<T, NMax, false>::PiecewiseBase;
+
+    MUSTARD_ALWAYS_INLINE constexpr auto operator()(UniformRandomBitGenerator auto& g) -> auto { return Impl(g, this->fParameter); }
+    MUSTARD_ALWAYS_INLINE constexpr auto operator()(UniformRandomBitGenerator auto& g, const PiecewiseConstantParameter<T, NMax>& p) -> auto { return Impl(g, p); }
+
+    MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g) -> auto { return Impl(g, this->fParameter); }
+    MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g, const PiecewiseConstantParameter<T, NMax>& p) -> auto { return Impl(g, p); }
+
+private:
+    MUSTARD_ALWAYS_INLINE static constexpr auto Impl(auto& g, const PiecewiseConstantParameter<T, NMax>& p) -> T;
+};
+
+template<std::floating_point T, std::size_t NMax>
+using PiecewiseLinearParameter = internal::BasicPiecewiseParameter<T, NMax, true>;
+
+template<std::floating_point T, std::size_t NMax>
+class PiecewiseLinear final : public internal::PiecewiseBase<T, NMax, true> {
+public:
+    using internal::PiecewiseBase<T, NMax, true>::PiecewiseBase;
+
+    MUSTARD_ALWAYS_INLINE constexpr auto operator()(UniformRandomBitGenerator auto& g) -> auto { return Impl(g, this->fParameter); }
+    MUSTARD_ALWAYS_INLINE constexpr auto operator()(UniformRandomBitGenerator auto& g, const PiecewiseLinearParameter<T, NMax>& p) -> auto { return Impl(g, p); }
+
+    MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g) -> auto { return Impl(g, this->fParameter); }
+    MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g, const PiecewiseLinearParameter<T, NMax>& p) -> auto { return Impl(g, p); }
+
+private:
+    MUSTARD_ALWAYS_INLINE static constexpr auto Impl(auto& g, const PiecewiseLinearParameter<T, NMax>& p) -> T;
+};
+
+} // namespace Mustard::Math::Random::inline Distribution
+
+#include "Mustard/Math/Random/Distribution/Piecewise.inl"
@@ -0,0 +1,165 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Math::Random::inline Distribution {
+
+namespace internal {
+
+template<std::floating_point T, std::size_t NMax, bool ALinear>
+constexpr BasicPiecewiseParameter<T, NMax, ALinear>::BasicPiecewiseParameter() :
+    Base{},
+    fX{0, 1},
+    fDensity{1, 1},
+    fTable{} {}
+
+template<std::floating_point T, std::size_t NMax, bool ALinear>
+BasicPiecewiseParameter<T, NMax, ALinear>::BasicPiecewiseParameter(std::span<const T> x, std::span<const T> density) :
+    Base{},
+    fX{},
+    fDensity{},
+    fTable{} {
+    if (x.size() < 2 or x.size() - 1 > NMax) {
+        Throw<std::length_error>(fmt::format("Number of intervals ({}) is not in [1, {}] (raise NMax)", x.empty() ? 0 : x.size() - 1, NMax));
+    }
+    if (density.size() != x.size() - not ALinear) {
+        Throw<std::invalid_argument>(fmt::format("Expect {} densities for {} boundaries (got {})",
+                                                 x.size() - not ALinear, x.size(), density.size()));
+    }
+    for (std::size_t i{}; i < x.size(); ++i) {
+        if (not std::isfinite(x[i]) or (i > 0 and not(x[i - 1] < x[i]))) {
+            Throw<std::invalid_argument>(fmt::format("Boundaries are not finite and strictly increasing at {} ({})", i, x[i]));
+        }
+    }
+    for (std::size_t i{}; i < density.size(); ++i) {
+        if (not(0 <= density[i] and density[i] < std::numeric_limits<T>::infinity())) {
+            Throw<std::invalid_argument>(fmt::format("Invalid density ({}) at {}", density[i], i));
+        }
+    }
+    std::ranges::copy(x, fX.begin());
+    std::ranges::copy(density, fDensity.begin());
+    std::vector<double> area(x.size() - 1);
+    for (std::size_t i{}; i < area.size(); ++i) {
+        const auto d{ALinear ? (density[i] + density[i + 1]) / 2 : density[i]};
+        area[i] = d * (x[i + 1] - x[i]);
+    }
+    fTable = AliasTable<NMax>{area};
+}
+
+template<std::floating_point T, std::size_t NMax, bool ALinear>
+BasicPiecewiseParameter<T, NMax, ALinear>::BasicPiecewiseParameter(const TH1& histogram) :
+    Base{},
+    fX{},
+    fDensity{},
+    fTable{} {
+    const auto nBin{histogram.GetNbinsX()};
+    std::vector<T> x;
+    std::vector<T> density;
+    x.reserve(nBin + 1);
+    density.reserve(nBin);
+    for (int i{1}; i <= nBin; ++i) {
+        x.emplace_back(ALinear ? histogram.GetBinCenter(i) : histogram.GetBinLowEdge(i));
+        density.emplace_back(histogram.GetBinContent(i) / histogram.GetBinWidth(i));
+    }
+    if (not ALinear) {
+        x.emplace_back(histogram.GetBinLowEdge(nBin + 1));
+    }
+    *this = BasicPiecewiseParameter{x, density};
+}
+
+template<std::floating_point T, std::size_t NMax, bool ALinear>
+template<muc::character AChar>
+auto BasicPiecewiseParameter<T, NMax, ALinear>::StreamOutput(std::basic_ostream<AChar>& os) const -> decltype(os) {
+    const auto oldPrecision{os.precision(std::numeric_limits<T>::max_digits10)};
+    os << NInterval() << ' ';
+    for (auto&& x : X()) {
+        os << x << ' ';
+    }
+    for (auto&& density : Density()) {
+        os << density << ' ';
+    }
+    return os << fTable
+              << std::setprecision(oldPrecision);
+}
+
+template<std::floating_point T, std::size_t NMax, bool ALinear>
+template<muc::character AChar>
+auto BasicPiecewiseParameter<T, NMax, ALinear>::StreamInput(std::basic_istream<AChar>& is) & -> decltype(is) {
+    std::size_t nInterval;
+    if (not(is >> nInterval) or nInterval == 0 or nInterval > NMax) {
+        is.setstate(std::ios::failbit);
+        return is;
+    }
+    BasicPiecewiseParameter parameter;
+    for (std::size_t i{}; i < nInterval + 1; ++i) {
+        is >> parameter.fX[i];
+    }
+    for (std::size_t i{}; i < nInterval + ALinear; ++i) {
+        is >> parameter.fDensity[i];
+    }
+    is >> parameter.fTable;
+    if (is and parameter.NInterval() == nInterval) {
+        *this = parameter;
+    } else {
+        is.setstate(std::ios::failbit);
+    }
+    return is;
+}
+
+template<std::floating_point T, std::size_t NMax, bool ALinear>
+PiecewiseBase<T, NMax, ALinear>::PiecewiseBase(std::span<const T> x, std::span<const T> density) :
+    Base{},
+    fParameter{x, density} {}
+
+template<std::floating_point T, std::size_t NMax, bool ALinear>
+PiecewiseBase<T, NMax, ALinear>::PiecewiseBase(const TH1& histogram) :
+    Base{},
+    fParameter{histogram} {}
+
+template<std::floating_point T, std::size_t NMax, bool ALinear>
+constexpr PiecewiseBase<T, NMax, ALinear>::PiecewiseBase(const typename Base::ParameterType& p) :
+    Base{},
+    fParameter{p} {}
+
+} // namespace internal
+
+template<std::floating_point T, std::size_t NMax>
+MUSTARD_ALWAYS_INLINE constexpr auto PiecewiseConstant<T, NMax>::Impl(auto& g, const PiecewiseConstantParameter<T, NMax>& p) -> T {
+    static_assert(Uniform<double>::Stateless());
+    static_assert(Uniform<T>::Stateless());
+    const auto i{p.Table()(Uniform<double>{}(g))};
+    const auto x{p.X()};
+    return x[i] + Uniform<T>{}(g) * (x[i + 1] - x[i]);
+}
+
+template<std::floating_point T, std::size_t NMax>
+MUSTARD_ALWAYS_INLINE constexpr auto PiecewiseLinear<T, NMax>::Impl(auto& g, const PiecewiseLinearParameter<T, NMax>& p) -> T {
+    static_assert(Uniform<double>::Stateless());
+    static_assert(Uniform<T>::Stateless());
+    const auto i{p.Table()(Uniform<double>{}(g))};
+    const auto x{p.X()};
+    const auto d0{p.Density()[i]};
+    const auto d1{p.Density()[i + 1]};
+    // inverse CDF of the trapezoid, in a form free of cancellation. The
+    // denominator vanishes only at u = 0 on a zero left density, i.e. t = 0
+    const auto u{Uniform<T>{}(g)};
+    const auto denominator{d0 + std::sqrt(d0 * d0 + u * (d1 * d1 - d0 * d0))};
+    const auto t{denominator > 0 ? u * (d0 + d1) / denominator : 0};
+    return x[i] + t * (x[i + 1] - x[i]);
+}
+
+} // namespace Mustard::Math::Random::inline Distribution
@@ -29,6 +29,7 @@
 #include <concepts>
 #include <iomanip>
 #include <random>
+#include <span>
 #include <type_traits>
 
 namespace Mustard::Math::Random::inline Distribution {
@@ -163,6 +164,11 @@ public:
     MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g) -> auto { return Impl(g, this->fParameter); }
     MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g, const UniformParameter<T>& p) -> auto { return Impl(g, p); }
 
+    /// @brief Fill with uniform random numbers. Uses the bulk interface of the
+    /// generator (Fill(span) or CLHEP flatArray) when available.
+    constexpr auto Generate(auto& g, std::span<T> out) -> void { Generate(g, out, this->fParameter); }
+    constexpr auto Generate(auto& g, std::span<T> out, const UniformParameter<T>& p) -> void;
+
 private:
     MUSTARD_ALWAYS_INLINE static constexpr auto Impl(auto& g, const UniformParameter<T>& p) -> T;
 };
@@ -67,7 +67,9 @@ template<std::floating_point T>
 MUSTARD_ALWAYS_INLINE constexpr auto UniformCompact<T>::operator()(UniformRandomBitGenerator auto& g, const UniformCompactParameter<T>& p) -> T {
     T u;
     if constexpr (std::numeric_limits<T>::is_iec559 and std::same_as<T, double> and
-                  std::same_as<decltype(g()), std::uint64_t>) {
+                  std::same_as<decltype(g()), std::uint64_t> and
+                  std::remove_cvref_t<decltype(g)>::Min() == 0 and
+                  std::remove_cvref_t<decltype(g)>::Max() == std::numeric_limits<std::uint64_t>::max()) { // not e.g. MT1993732, whose result type is std::uint_fast32_t
         u = (g() >> 11) * 0x1.0p-53;
     } else {
         u = static_cast<T>(g() - g.Min()) / (g.Max() - g.Min());
@@ -94,6 +96,23 @@ MUSTARD_ALWAYS_INLINE constexpr auto UniformReal<T>::Impl(auto& g, const Uniform
     return p.Infimum() + u * (p.Supremum() - p.Infimum());
 }
 
+template<std::floating_point T>
+constexpr auto UniformReal<T>::Generate(auto& g, std::span<T> out, const UniformParameter<T>& p) -> void {
+    if constexpr (requires { g.Fill(out); }) {
+        g.Fill(out);
+    } else if constexpr (std::derived_from<std::remove_cvref_t<decltype(g)>, CLHEP::HepRandomEngine> and
+                         std::same_as<T, double>) {
+        g.flatArray(out.size(), out.data());
+    } else {
+        for (auto&& u : out) {
+            u = Impl(g, {});
+        }
+    }
+    for (auto&& u : out) {
+        u = p.Infimum() + u * (p.Supremum() - p.Infimum());
+    }
+}
+
 template<std::integral T>
 MUSTARD_ALWAYS_INLINE constexpr auto UniformInteger<T>::operator()(UniformRandomBitGenerator auto& g, const UniformParameter<T>& p) -> T {
     // Do we need an independent implementation?
@@ -15,3 +15,203 @@
 //
 // You should have received a copy of the GNU General Public License along with
 // Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Concept/MathVector.h++"
+#include "Mustard/Concept/NumericVector.h++"
+#include "Mustard/Math/Random/Distribution/UniformCuboid.h++"
+#include "Mustard/Math/Random/RandomNumberDistributionBase.h++"
+#include "Mustard/Math/internal/SinCos2PiOn01.h++"
+#include "Mustard/Utility/FunctionAttribute.h++"
+#include "Mustard/Utility/VectorValueType.h++"
+
+#include "CLHEP/Random/RandomEngine.h"
+
+#include "muc/array"
+#include "muc/concepts"
+#include "muc/math"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <iomanip>
+#include <span>
+
+namespace Mustard::Math::Random::inline Distribution {
+
+namespace internal {
+
+template<Concept::NumericVector3Any T, template<typename> typename AUniformBall>
+class BasicUniformBallParameter final : public DistributionParameterBase<BasicUniformBallParameter<T, AUniformBall>,
+                                                                         AUniformBall<T>> {
+private:
+    using VT = VectorValueType<T>;
+    using Base = DistributionParameterBase<BasicUniformBallParameter<T, AUniformBall>,
+                                           AUniformBall<T>>;
+
+public:
+    constexpr BasicUniformBallParameter();
+    constexpr BasicUniformBallParameter(VT r, VT x0, VT y0, VT z0);
+    constexpr BasicUniformBallParameter(VT radius, T center);
+    constexpr explicit BasicUniformBallParameter(VT radius);
+
+    constexpr auto Radius() const -> auto { return fRadius; }
+    constexpr auto CenterX() const -> auto { return fCenterX; }
+    constexpr auto CenterY() const -> auto { return fCenterY; }
+    constexpr auto CenterZ() const -> auto { return fCenterZ; }
+    constexpr auto Center() const -> T { return {fCenterX, fCenterY, fCenterZ}; }
+
+    constexpr auto Radius(VT r) -> void { fRadius = r; }
+    constexpr auto CenterX(VT x0) -> void { fCenterX = x0; }
+    constexpr auto CenterY(VT y0) -> void { fCenterY = y0; }
+    constexpr auto CenterZ(VT z0) -> void { fCenterZ = z0; }
+    constexpr auto Center(VT x0, VT y0, VT z0) -> void { CenterX(x0), CenterY(y0), CenterZ(z0); }
+    constexpr auto Center(T r0) -> void { Center(r0[0], r0[1], r0[2]); }
+
+    template<muc::character AChar>
+    friend auto operator<<(std::basic_ostream<AChar>& os, const BasicUniformBallParameter& self) -> decltype(os) { return self.StreamOutput(os); }
+    template<muc::character AChar>
+    friend auto operator>>(std::basic_istream<AChar>& is, BasicUniformBallParameter& self) -> decltype(is) { return self.StreamInput(is); }
+
+private:
+    template<muc::character AChar>
+    auto StreamOutput(std::basic_ostream<AChar>& os) const -> decltype(os);
+    template<muc::character AChar>
+    auto StreamInput(std::basic_istream<AChar>& is) & -> decltype(is);
+
+private:
+    VT fRadius;
+    VT fCenterX;
+    VT fCenterY;
+    VT fCenterZ;
+};
+
+template<Concept::NumericVector3Any T, template<typename> typename AUniformBall>
+class UniformBallBase : public RandomNumberDistributionBase<AUniformBall<T>,
+                                                            BasicUniformBallParameter<T, AUniformBall>,
+                                                            T> {
+private:
+    using VT = VectorValueType<T>;
+    using Base = RandomNumberDistributionBase<AUniformBall<T>,
+                                              BasicUniformBallParameter<T, AUniformBall>,
+                                              T>;
+
+public:
+    constexpr UniformBallBase() = default;
+    constexpr UniformBallBase(VT r, VT x0, VT y0, VT z0);
+    constexpr UniformBallBase(VT radius, T center);
+    constexpr explicit UniformBallBase(VT radius);
+    constexpr explicit UniformBallBase(const typename Base::ParameterType& p);
+
+protected:
+    constexpr ~UniformBallBase() = default;
+
+public:
+    constexpr auto Reset() -> void {}
+
+    constexpr auto Parameter() const -> auto { return fParameter; }
+    constexpr auto Radius() const -> auto { return fParameter.Radius(); }
+    constexpr auto CenterX() const -> auto { return fParameter.CenterX(); }
+    constexpr auto CenterY() const -> auto { return fParameter.CenterY(); }
+    constexpr auto CenterZ() const -> auto { return fParameter.CenterZ(); }
+    constexpr auto Center() const -> auto { return fParameter.Center(); }
+
+    constexpr auto Parameter(const typename Base::ParameterType& p) -> void { fParameter = p; }
+    constexpr auto Radius(VT r) -> void { fParameter.Radius(r); }
+    constexpr auto CenterX(VT x0) -> void { fParameter.CenterX(x0); }
+    constexpr auto CenterY(VT y0) -> void { fParameter.CenterY(y0); }
+    constexpr auto CenterZ(VT z0) -> void { fParameter.CenterZ(z0); }
+    constexpr auto Center(VT x0, VT y0, VT z0) -> void { fParameter.Center(x0, y0, z0); }
+    constexpr auto Center(T r0) -> void { fParameter.Center(r0); }
+
+    constexpr auto Min() const -> T { return {CenterX() - Radius(), CenterY() - Radius(), CenterZ() - Radius()}; }
+    constexpr auto Max() const -> T { return {CenterX() + Radius(), CenterY() + Radius(), CenterZ() + Radius()}; }
+
+    static constexpr auto Stateless() -> bool { return true; }
+
+    template<muc::character AChar>
+    friend auto operator<<(std::basic_ostream<AChar>& os, const UniformBallBase<T, AUniformBall>& self) -> auto& { return os << self.fParameter; }
+    template<muc::character AChar>
+    friend auto operator>>(std::basic_istream<AChar>& is, UniformBallBase<T, AUniformBall>& self) -> auto& { return is >> self.fParameter; }
+
+protected:
+    static auto GenerateBatch(auto& g, std::span<T> out, const DistributionParameter auto& p) -> void;
+
+protected:
+    typename Base::ParameterType fParameter;
+};
+
+} // namespace internal
+
+template<Concept::NumericVector3Any T = muc::array3d>
+class UniformCompactBall;
+
+template<Concept::NumericVector3Any T>
+using UniformCompactBallParameter = internal::BasicUniformBallParameter<T, UniformCompactBall>;
+
+template<Concept::NumericVector3Any T>
+class UniformCompactBall final : public internal::UniformBallBase<T, UniformCompactBall> {
+public:
+    using internal::UniformBallBase<T, UniformCompactBall>::UniformBallBase;
+
+    MUSTARD_ALWAYS_INLINE constexpr auto operator()(UniformRandomBitGenerator auto& g) -> auto { return Impl(g, this->fParameter); }
+    MUSTARD_ALWAYS_INLINE constexpr auto operator()(UniformRandomBitGenerator auto& g, const UniformCompactBallParameter<T>& p) -> auto { return Impl(g, p); }
+
+    MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g) -> auto { return Impl(g, this->fParameter); }
+    MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g, const UniformCompactBallParameter<T>& p) -> auto { return Impl(g, p); }
+
+    /// @brief Fill with random numbers of the distribution, by a vectorizable
+    /// spherical kernel over a batch of uniform random numbers.
+    auto Generate(auto& g, std::span<T> out) -> void { this->GenerateBatch(g, out, this->fParameter); }
+    auto Generate(auto& g, std::span<T> out, const UniformCompactBallParameter<T>& p) -> void { this->GenerateBatch(g, out, p); }
+
+private:
+    MUSTARD_ALWAYS_INLINE static constexpr auto Impl(auto& g, const UniformCompactBallParameter<T>& p) -> T;
+};
+
+template<typename VT, typename T>
+UniformCompactBall(VT, T) -> UniformCompactBall<std::enable_if_t<std::same_as<VT, VectorValueType<std::decay_t<T>>>, std::decay_t<T>>>;
+template<typename T, typename U, typename V, typename W>
+UniformCompactBall(T, U, V, W) -> UniformCompactBall<std::array<std::common_type_t<T, U, V, W>, 3>>;
+template<typename T>
+UniformCompactBall(T) -> UniformCompactBall<std::array<T, 3>>;
+
+template<Concept::NumericVector3Any T = muc::array3d>
+class UniformBall;
+
+template<Concept::NumericVector3Any T>
+using UniformBallParameter = internal::BasicUniformBallParameter<T, UniformBall>;
+
+template<Concept::NumericVector3Any T>
+class UniformBall final : public internal::UniformBallBase<T, UniformBall> {
+public:
+    using internal::UniformBallBase<T, UniformBall>::UniformBallBase;
+
+    MUSTARD_ALWAYS_INLINE constexpr auto operator()(UniformRandomBitGenerator auto& g) -> auto { return Impl(g, this->fParameter); }
+    MUSTARD_ALWAYS_INLINE constexpr auto operator()(UniformRandomBitGenerator auto& g, const UniformBallParameter<T>& p) -> auto { return Impl(g, p); }
+
+    MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g) -> auto { return Impl(g, this->fParameter); }
+    MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g, const UniformBallParameter<T>& p) -> auto { return Impl(g, p); }
+
+    /// @brief Fill with random numbers of the distribution, by a vectorizable
+    /// spherical kernel over a batch of uniform random numbers.
+    auto Generate(auto& g, std::span<T> out) -> void { this->GenerateBatch(g, out, this->fParameter); }
+    auto Generate(auto& g, std::span<T> out, const UniformBallParameter<T>& p) -> void { this->GenerateBatch(g, out, p); }
+
+private:
+    MUSTARD_ALWAYS_INLINE static constexpr auto Impl(auto& g, const UniformBallParameter<T>& p) -> T;
+};
+
+template<typename VT, typename T>
+UniformBall(VT, T) -> UniformBall<std::enable_if_t<std::same_as<VT, VectorValueType<std::decay_t<T>>>, std::decay_t<T>>>;
+template<typename T, typename U, typename V, typename W>
+UniformBall(T, U, V, W) -> UniformBall<std::array<std::common_type_t<T, U, V, W>, 3>>;
+template<typename T>
+UniformBall(T) -> UniformBall<std::array<T, 3>>;
+
+} // namespace Mustard::Math::Random::inline Distribution
+
+#include "Mustard/Math/Random/Distribution/UniformBall.inl"
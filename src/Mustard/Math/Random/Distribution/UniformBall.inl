@@ -15,3 +15,134 @@
 //
 // You should have received a copy of the GNU General Public License along with
 // Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Math::Random::inline Distribution {
+
+namespace internal {
+
+template<Concept::NumericVector3Any T, template<typename> typename AUniformBall>
+constexpr BasicUniformBallParameter<T, AUniformBall>::BasicUniformBallParameter() :
+    BasicUniformBallParameter{1} {}
+
+template<Concept::NumericVector3Any T, template<typename> typename AUniformBall>
+constexpr BasicUniformBallParameter<T, AUniformBall>::BasicUniformBallParameter(VT r, VT x0, VT y0, VT z0) :
+    Base{},
+    fRadius{r},
+    fCenterX{x0},
+    fCenterY{y0},
+    fCenterZ{z0} {}
+
+template<Concept::NumericVector3Any T, template<typename> typename AUniformBall>
+constexpr BasicUniformBallParameter<T, AUniformBall>::BasicUniformBallParameter(VT radius, T center) :
+    Base{},
+    fRadius{radius},
+    fCenterX{center[0]},
+    fCenterY{center[1]},
+    fCenterZ{center[2]} {}
+
+template<Concept::NumericVector3Any T, template<typename> typename AUniformBall>
+constexpr BasicUniformBallParameter<T, AUniformBall>::BasicUniformBallParameter(VT radius) :
+    Base{},
+    fRadius{radius},
+    fCenterX{0},
+    fCenterY{0},
+    fCenterZ{0} {}
+
+template<Concept::NumericVector3Any T, template<typename> typename AUniformBall>
+template<muc::character AChar>
+auto BasicUniformBallParameter<T, AUniformBall>::StreamOutput(std::basic_ostream<AChar>& os) const -> decltype(os) {
+    const auto oldPrecision{os.precision(std::numeric_limits<VectorValueType<T>>::max_digits10)};
+    return os << fRadius << ' ' << fCenterX << ' ' << fCenterY << ' ' << fCenterZ
+              << std::setprecision(oldPrecision);
+}
+
+template<Concept::NumericVector3Any T, template<typename> typename AUniformBall>
+template<muc::character AChar>
+auto BasicUniformBallParameter<T, AUniformBall>::StreamInput(std::basic_istream<AChar>& is) & -> decltype(is) {
+    return is >> fRadius >> fCenterX >> fCenterY >> fCenterZ;
+}
+
+template<Concept::NumericVector3Any T, template<typename> typename AUniformBall>
+constexpr UniformBallBase<T, AUniformBall>::UniformBallBase(VT r, VT x0, VT y0, VT z0) :
+    Base{},
+    fParameter{r, x0, y0, z0} {}
+
+template<Concept::NumericVector3Any T, template<typename> typename AUniformBall>
+constexpr UniformBallBase<T, AUniformBall>::UniformBallBase(VT radius, T center) :
+    Base{},
+    fParameter{radius, center} {}
+
+template<Concept::NumericVector3Any T, template<typename> typename AUniformBall>
+constexpr UniformBallBase<T, AUniformBall>::UniformBallBase(VT radius) :
+    Base{},
+    fParameter{radius} {}
+
+template<Concept::NumericVector3Any T, template<typename> typename AUniformBall>
+constexpr UniformBallBase<T, AUniformBall>::UniformBallBase(const typename Base::ParameterType& p) :
+    Base{},
+    fParameter{p} {}
+
+template<Concept::NumericVector3Any T, template<typename> typename AUniformBall>
+auto UniformBallBase<T, AUniformBall>::GenerateBatch(auto& g, std::span<T> out, const DistributionParameter auto& p) -> void {
+    // max(u1, u2, u3) is distributed as r / R (CDF x^3), and the direction is
+    // uniform on the sphere (see UniformSphere). Uniforms are drawn into a
+    // block on the stack.
+    constexpr std::size_t blockSize{256};
+    std::array<VT, 5 * blockSize> block;
+    for (std::size_t k{}; k < out.size(); k += blockSize) {
+        const auto n{std::min(blockSize, out.size() - k)};
+        Uniform<VT>{}.Generate(g, std::span{block}.first(5 * n));
+        for (std::size_t i{}; i < n; ++i) {
+            const auto u{block[3 * n + i]};
+            block[i] = p.Radius() * std::max({block[i], block[n + i], block[2 * n + i]});
+            block[n + i] = 4 * u * (1 - u);
+            block[2 * n + i] = 1 - 2 * u;
+        }
+        // separated, as sqrt is not vectorized if it may set errno
+        for (std::size_t i{}; i < n; ++i) {
+            block[n + i] = std::sqrt(block[n + i]);
+        }
+        for (std::size_t i{}; i < n; ++i) {
+            const auto r{block[i]};
+            const auto rho{r * block[n + i]};
+            const auto [sin, cos]{Math::internal::SinCos2PiOn01(block[4 * n + i])};
+            auto& x{out[k + i]};
+            x[0] = rho * cos + p.CenterX();
+            x[1] = rho * sin + p.CenterY();
+            x[2] = r * block[2 * n + i] + p.CenterZ();
+        }
+    }
+}
+
+} // namespace internal
+
+#define MUSTARD_MATH_RANDOM_DISTRIBUTION_UNIFORM_BALL_GENERATOR(rejection)      \
+    T r;                                                                        \
+    VectorValueType<T> r2;                                                      \
+    do {                                                                        \
+        r = UniformCompactCuboid<T>({-0.5, 0.5}, {-0.5, 0.5}, {-0.5, 0.5})(g);  \
+        r2 = muc::hypot_sq(r[0], r[1], r[2]);                                   \
+        muc::assume(0 <= r2 and r2 <= 0.75);                                    \
+    } while (rejection);                                                        \
+    if constexpr (Concept::MathVector3Any<T>) {                                 \
+        r = 2 * p.Radius() * r + p.Center();                                    \
+    } else {                                                                    \
+        r[0] = 2 * p.Radius() * r[0] + p.Center()[0];                           \
+        r[1] = 2 * p.Radius() * r[1] + p.Center()[1];                           \
+        r[2] = 2 * p.Radius() * r[2] + p.Center()[2];                           \
+    }                                                                           \
+    return r;
+
+template<Concept::NumericVector3Any T>
+MUSTARD_ALWAYS_INLINE constexpr auto UniformCompactBall<T>::Impl(auto& g, const UniformCompactBallParameter<T>& p) -> T {
+    MUSTARD_MATH_RANDOM_DISTRIBUTION_UNIFORM_BALL_GENERATOR(r2 > 0.25)
+}
+
+template<Concept::NumericVector3Any T>
+MUSTARD_ALWAYS_INLINE constexpr auto UniformBall<T>::Impl(auto& g, const UniformBallParameter<T>& p) -> T {
+    MUSTARD_MATH_RANDOM_DISTRIBUTION_UNIFORM_BALL_GENERATOR(r2 >= 0.25)
+}
+
+#undef MUSTARD_MATH_RANDOM_DISTRIBUTION_UNIFORM_BALL_GENERATOR
+
+} // namespace Mustard::Math::Random::inline Distribution
@@ -15,3 +15,160 @@
 //
 // You should have received a copy of the GNU General Public License along with
 // Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Concept/NumericVector.h++"
+#include "Mustard/Math/Random/Distribution/Joint.h++"
+#include "Mustard/Math/Random/Distribution/Uniform.h++"
+#include "Mustard/Math/Random/RandomNumberDistributionBase.h++"
+#include "Mustard/Utility/VectorValueType.h++"
+
+#include "muc/array"
+
+#include <array>
+#include <concepts>
+#include <iomanip>
+#include <type_traits>
+
+namespace Mustard::Math::Random::inline Distribution {
+
+namespace internal {
+
+template<Concept::NumericVector3Any T, template<typename> typename AUniformCuboid, template<typename> typename AUniform>
+class BasicUniformCuboidParameter final : public JointParameterInterface<BasicUniformCuboidParameter<T, AUniformCuboid, AUniform>,
+                                                                         AUniformCuboid<T>,
+                                                                         AUniform<VectorValueType<T>>,
+                                                                         AUniform<VectorValueType<T>>,
+                                                                         AUniform<VectorValueType<T>>> {
+private:
+    using VT = VectorValueType<T>;
+    using Base = JointParameterInterface<BasicUniformCuboidParameter<T, AUniformCuboid, AUniform>,
+                                         AUniformCuboid<T>,
+                                         AUniform<VT>,
+                                         AUniform<VT>,
+                                         AUniform<VT>>;
+
+public:
+    using Base::Base;
+
+    constexpr auto ParameterX() const -> auto { return this->template Parameter<0>(); }
+    constexpr auto InfimumX() const -> auto { return ParameterX().Infimum(); }
+    constexpr auto SupremumX() const -> auto { return ParameterX().Supremum(); }
+    constexpr auto ParameterY() const -> auto { return this->template Parameter<1>(); }
+    constexpr auto InfimumY() const -> auto { return ParameterY().Infimum(); }
+    constexpr auto SupremumY() const -> auto { return ParameterY().Supremum(); }
+    constexpr auto ParameterZ() const -> auto { return this->template Parameter<2>(); }
+    constexpr auto InfimumZ() const -> auto { return ParameterZ().Infimum(); }
+    constexpr auto SupremumZ() const -> auto { return ParameterZ().Supremum(); }
+
+    constexpr auto ParameterX(const typename AUniform<VT>::ParameterType x) -> void { Parameter<0>(x); }
+    constexpr auto InfimumX(VT infX) -> void { ParameterX({infX, SupremumX()}); }
+    constexpr auto SupremumX(VT supX) -> void { ParameterX({InfimumX(), supX}); }
+    constexpr auto ParameterY(const typename AUniform<VT>::ParameterType y) -> void { Parameter<1>(y); }
+    constexpr auto InfimumY(VT infY) -> void { ParameterY({infY, SupremumY()}); }
+    constexpr auto SupremumY(VT supY) -> void { ParameterY({InfimumY(), supY}); }
+    constexpr auto ParameterZ(const typename AUniform<VT>::ParameterType z) -> void { Parameter<2>(z); }
+    constexpr auto InfimumZ(VT infZ) -> void { ParameterZ({infZ, SupremumZ()}); }
+    constexpr auto SupremumZ(VT supZ) -> void { ParameterZ({InfimumZ(), supZ}); }
+};
+
+template<template<typename> typename ADerived, Concept::NumericVector3Any T, template<typename> typename AUniform>
+class UniformCuboidBase : public JointInterface<ADerived<T>,
+                                                BasicUniformCuboidParameter<T, ADerived, AUniform>,
+                                                T,
+                                                AUniform<VectorValueType<T>>,
+                                                AUniform<VectorValueType<T>>,
+                                                AUniform<VectorValueType<T>>> {
+private:
+    using VT = VectorValueType<T>;
+    using Base = JointInterface<ADerived<T>,
+                                BasicUniformCuboidParameter<T, ADerived, AUniform>,
+                                T,
+                                AUniform<VT>,
+                                AUniform<VT>,
+                                AUniform<VT>>;
+
+public:
+    using Base::Base;
+
+protected:
+    constexpr ~UniformCuboidBase() = default;
+
+public:
+    constexpr auto ParameterX() const -> auto { return Base::template Parameter<0>(); }
+    constexpr auto InfimumX() const -> auto { return ParameterX().Infimum(); }
+    constexpr auto SupremumX() const -> auto { return ParameterX().Supremum(); }
+    constexpr auto ParameterY() const -> auto { return Base::template Parameter<1>(); }
+    constexpr auto InfimumY() const -> auto { return ParameterY().Infimum(); }
+    constexpr auto SupremumY() const -> auto { return ParameterY().Supremum(); }
+    constexpr auto ParameterZ() const -> auto { return Base::template Parameter<2>(); }
+    constexpr auto InfimumZ() const -> auto { return ParameterZ().Infimum(); }
+    constexpr auto SupremumZ() const -> auto { return ParameterZ().Supremum(); }
+
+    constexpr auto ParameterX(const typename AUniform<VT>::ParameterType& x) -> void { Base::template Parameter<0>(x); }
+    constexpr auto InfimumX(VT infX) -> void { ParameterX({infX, SupremumX()}); }
+    constexpr auto SupremumX(VT supX) -> void { ParameterX({InfimumX(), supX}); }
+    constexpr auto ParameterY(const typename AUniform<VT>::ParameterType& y) -> void { Base::template Parameter<1>(y); }
+    constexpr auto InfimumY(VT infY) -> void { ParameterY({infY, SupremumY()}); }
+    constexpr auto SupremumY(VT supY) -> void { ParameterY({InfimumY(), supY}); }
+    constexpr auto ParameterZ(const typename AUniform<VT>::ParameterType& z) -> void { Base::template Parameter<2>(z); }
+    constexpr auto InfimumZ(VT infZ) -> void { ParameterZ({infZ, SupremumZ()}); }
+    constexpr auto SupremumZ(VT supZ) -> void { ParameterZ({InfimumZ(), supZ}); }
+};
+
+} // namespace internal
+
+/// @brief Generates 3D uniform random vector on a compact (including boundary) cuboid region.
+/// @tparam T The result vector type. It must be 3-dimensional and has floating-point type.
+template<Concept::NumericVector3FloatingPoint T = muc::array3d>
+class UniformCompactCuboid final : public internal::UniformCuboidBase<UniformCompactCuboid, T, UniformCompact> {
+public:
+    using internal::UniformCuboidBase<UniformCompactCuboid, T, UniformCompact>::UniformCuboidBase;
+};
+
+template<typename T, typename U, typename V>
+UniformCompactCuboid(std::initializer_list<T>, std::initializer_list<U>, std::initializer_list<V>) -> UniformCompactCuboid<std::array<std::common_type_t<T, U, V>, 3>>;
+
+template<std::floating_point T>
+using UniformCompactCuboidParameter = internal::BasicUniformCuboidParameter<T, UniformCompactCuboid, UniformCompact>;
+
+/// @brief Generates 3D uniform random vector on a open (excluding boundary) cuboid region.
+/// @tparam T The result vector type. It must be 3-dimensional and has floating-point type.
+template<Concept::NumericVector3FloatingPoint T = muc::array3d>
+class UniformRealCuboid;
+
+/// @brief Generates 3D uniform random integral vector on a cuboid region.
+/// @tparam T The result vector type. It must be 3-dimensional and has integral type.
+template<Concept::NumericVector3Integral T = muc::array3i>
+class UniformIntegerCuboid;
+
+/// @brief Generates 3D uniform random vector on a cuboid region.
+/// @tparam T The result vector type.
+template<Concept::NumericVector3Any T>
+using UniformCuboid = std::conditional_t<std::floating_point<VectorValueType<T>>,
+                                         UniformRealCuboid<std::conditional_t<std::floating_point<VectorValueType<T>>, T, muc::array3d>>,
+                                         UniformIntegerCuboid<std::conditional_t<std::integral<VectorValueType<T>>, T, muc::array3i>>>;
+
+template<Concept::NumericVector3Any T>
+using UniformCuboidParameter = internal::BasicUniformCuboidParameter<T, UniformCuboid, Uniform>;
+
+template<Concept::NumericVector3FloatingPoint T>
+class UniformRealCuboid final : public internal::UniformCuboidBase<UniformRealCuboid, T, Uniform> {
+public:
+    using internal::UniformCuboidBase<UniformRealCuboid, T, Uniform>::UniformCuboidBase;
+};
+
+template<typename T, typename U, typename V>
+UniformRealCuboid(std::initializer_list<T>, std::initializer_list<U>, std::initializer_list<V>) -> UniformRealCuboid<std::array<std::common_type_t<T, U, V>, 3>>;
+
+template<Concept::NumericVector3Integral T>
+class UniformIntegerCuboid final : public internal::UniformCuboidBase<UniformIntegerCuboid, T, Uniform> {
+public:
+    using internal::UniformCuboidBase<UniformIntegerCuboid, T, Uniform>::UniformCuboidBase;
+};
+
+template<typename T, typename U, typename V>
+UniformIntegerCuboid(std::initializer_list<T>, std::initializer_list<U>, std::initializer_list<V>) -> UniformIntegerCuboid<std::array<std::common_type_t<T, U, V>, 3>>;
+
+} // namespace Mustard::Math::Random::inline Distribution
@@ -22,6 +22,7 @@
 #include "Mustard/Concept/NumericVector.h++"
 #include "Mustard/Math/Random/Distribution/UniformRectangle.h++"
 #include "Mustard/Math/Random/RandomNumberDistributionBase.h++"
+#include "Mustard/Math/internal/SinCos2PiOn01.h++"
 #include "Mustard/Utility/FunctionAttribute.h++"
 #include "Mustard/Utility/VectorValueType.h++"
 
@@ -31,10 +32,13 @@
 #include "muc/concepts"
 #include "muc/math"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <concepts>
+#include <cstddef>
 #include <iomanip>
+#include <span>
 
 namespace Mustard::Math::Random::inline Distribution {
 
@@ -130,6 +134,7 @@ public:
 
 protected:
     static constexpr auto UniformCompactDisk(UniformRandomBitGenerator auto& g, const DistributionParameter auto& p) -> std::pair<T, VT>;
+    static auto GenerateBatch(auto& g, std::span<T> out, const DistributionParameter auto& p) -> void;
 
 protected:
     typename Base::ParameterType fParameter;
@@ -154,6 +159,11 @@ public:
     MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g) -> auto { return Impl(g, this->fParameter); }
     MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g, const UniformCompactDiskParameter<T>& p) -> auto { return Impl(g, p); }
 
+    /// @brief Fill with random numbers of the distribution, by a vectorizable
+    /// polar kernel over a batch of uniform random numbers.
+    auto Generate(auto& g, std::span<T> out) -> void { this->GenerateBatch(g, out, this->fParameter); }
+    auto Generate(auto& g, std::span<T> out, const UniformCompactDiskParameter<T>& p) -> void { this->GenerateBatch(g, out, p); }
+
 private:
     MUSTARD_ALWAYS_INLINE static constexpr auto Impl(auto& g, const UniformCompactDiskParameter<T>& p) -> T;
 };
@@ -182,6 +192,11 @@ public:
     MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g) -> auto { return Impl(g, this->fParameter); }
     MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g, const UniformDiskParameter<T>& p) -> auto { return Impl(g, p); }
 
+    /// @brief Fill with random numbers of the distribution, by a vectorizable
+    /// polar kernel over a batch of uniform random numbers.
+    auto Generate(auto& g, std::span<T> out) -> void { this->GenerateBatch(g, out, this->fParameter); }
+    auto Generate(auto& g, std::span<T> out, const UniformDiskParameter<T>& p) -> void { this->GenerateBatch(g, out, p); }
+
 private:
     MUSTARD_ALWAYS_INLINE static constexpr auto Impl(auto& g, const UniformDiskParameter<T>& p) -> T;
 };
@@ -49,14 +49,14 @@ template<Concept::NumericVector2Any T, template<typename> typename AUniformDisk>
 template<muc::character AChar>
 auto BasicUniformDiskParameter<T, AUniformDisk>::StreamOutput(std::basic_ostream<AChar>& os) const -> decltype(os) {
     const auto oldPrecision{os.precision(std::numeric_limits<VectorValueType<T>>::max_digits10)};
-    return os << fRadius << ' ' << fCenter[0] << ' ' << fCenter[1]
+    return os << fRadius << ' ' << fCenterX << ' ' << fCenterY
               << std::setprecision(oldPrecision);
 }
 
 template<Concept::NumericVector2Any T, template<typename> typename AUniformDisk>
 template<muc::character AChar>
 auto BasicUniformDiskParameter<T, AUniformDisk>::StreamInput(std::basic_istream<AChar>& is) & -> decltype(is) {
-    return is >> fRadius >> fCenter[0] >> fCenter[1];
+    return is >> fRadius >> fCenterX >> fCenterY;
 }
 
 template<Concept::NumericVector2Any T, template<typename> typename AUniformDisk>
@@ -79,6 +79,25 @@ constexpr UniformDiskBase<T, AUniformDisk>::UniformDiskBase(const typename Base:
     Base{},
     fParameter{p} {}
 
+template<Concept::NumericVector2Any T, template<typename> typename AUniformDisk>
+auto UniformDiskBase<T, AUniformDisk>::GenerateBatch(auto& g, std::span<T> out, const DistributionParameter auto& p) -> void {
+    // max(u1, u2) is distributed as r / R (CDF x^2), so that neither sqrt nor
+    // rejection is needed. Uniforms are drawn into a block on the stack.
+    constexpr std::size_t blockSize{256};
+    std::array<VT, 3 * blockSize> block;
+    for (std::size_t k{}; k < out.size(); k += blockSize) {
+        const auto n{std::min(blockSize, out.size() - k)};
+        Uniform<VT>{}.Generate(g, std::span{block}.first(3 * n));
+        for (std::size_t i{}; i < n; ++i) {
+            const auto r{p.Radius() * std::max(block[i], block[n + i])};
+            const auto [sin, cos]{Math::internal::SinCos2PiOn01(block[2 * n + i])};
+            auto& x{out[k + i]};
+            x[0] = r * cos + p.CenterX();
+            x[1] = r * sin + p.CenterY();
+        }
+    }
+}
+
 } // namespace internal
 
 #define MUSTARD_MATH_RANDOM_DISTRIBUTION_UNIFORM_DISK_GENERATOR(rejection) \
@@ -15,3 +15,68 @@
 //
 // You should have received a copy of the GNU General Public License along with
 // Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Concept/MathVector.h++"
+#include "Mustard/Concept/NumericVector.h++"
+#include "Mustard/Math/Random/Distribution/UniformDisk.h++"
+#include "Mustard/Math/Random/Distribution/UniformRectangle.h++"
+#include "Mustard/Math/Random/RandomNumberDistributionBase.h++"
+#include "Mustard/Math/internal/SinCos2PiOn01.h++"
+#include "Mustard/Utility/FunctionAttribute.h++"
+#include "Mustard/Utility/VectorValueType.h++"
+
+#include "CLHEP/Random/RandomEngine.h"
+
+#include "muc/array"
+#include "muc/math"
+#include "muc/utility"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+namespace Mustard::Math::Random::inline Distribution {
+
+/// @brief Generates 2D uniform random vector on a circle, e.g. an isotropic
+/// direction in the plane by default. Same parameter as UniformDisk.
+/// @tparam T The result vector type. It must be 2-dimensional.
+template<Concept::NumericVector2Any T = muc::array2d>
+class UniformRing;
+
+template<Concept::NumericVector2Any T>
+using UniformRingParameter = internal::BasicUniformDiskParameter<T, UniformRing>;
+
+template<Concept::NumericVector2Any T>
+class UniformRing final : public internal::UniformDiskBase<T, UniformRing> {
+public:
+    using internal::UniformDiskBase<T, UniformRing>::UniformDiskBase;
+
+    MUSTARD_ALWAYS_INLINE constexpr auto operator()(UniformRandomBitGenerator auto& g) -> auto { return Impl(g, this->fParameter); }
+    MUSTARD_ALWAYS_INLINE constexpr auto operator()(UniformRandomBitGenerator auto& g, const UniformRingParameter<T>& p) -> auto { return Impl(g, p); }
+
+    MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g) -> auto { return Impl(g, this->fParameter); }
+    MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g, const UniformRingParameter<T>& p) -> auto { return Impl(g, p); }
+
+    /// @brief Fill with random numbers of the distribution, by a vectorizable
+    /// polar kernel over a batch of uniform random numbers.
+    auto Generate(auto& g, std::span<T> out) -> void { Generate(g, out, this->fParameter); }
+    auto Generate(auto& g, std::span<T> out, const UniformRingParameter<T>& p) -> void;
+
+private:
+    MUSTARD_ALWAYS_INLINE static constexpr auto Impl(auto& g, const UniformRingParameter<T>& p) -> T;
+};
+
+template<typename VT, typename T>
+UniformRing(VT, T) -> UniformRing<std::enable_if_t<std::same_as<VT, VectorValueType<std::decay_t<T>>>, std::decay_t<T>>>;
+template<typename T, typename U, typename V>
+UniformRing(T, U, V) -> UniformRing<std::array<std::common_type_t<T, U, V>, 2>>;
+template<typename T>
+UniformRing(T) -> UniformRing<std::array<T, 2>>;
+
+} // namespace Mustard::Math::Random::inline Distribution
+
+#include "Mustard/Math/Random/Distribution/UniformRing.inl"
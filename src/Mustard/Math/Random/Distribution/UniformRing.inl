@@ -15,3 +15,44 @@
 //
 // You should have received a copy of the GNU General Public License along with
 // Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Math::Random::inline Distribution {
+
+template<Concept::NumericVector2Any T>
+MUSTARD_ALWAYS_INLINE constexpr auto UniformRing<T>::Impl(auto& g, const UniformRingParameter<T>& p) -> T {
+    // J. von Neumann, NBS Appl. Math. Ser. 12 (1951) 36: (u, v) uniform in the
+    // unit disk maps to (u^2 - v^2, 2uv) / (u^2 + v^2) on the unit circle
+    T r;
+    VectorValueType<T> s;
+    do {
+        r = UniformCompactRectangle<T>({-1, 1}, {-1, 1})(g);
+        s = muc::hypot_sq(r[0], r[1]);
+        muc::assume(0 <= s and s <= 2);
+    } while (s >= 1 or s == 0);
+    const auto scale{p.Radius() / s};
+    const auto x{(r[0] - r[1]) * (r[0] + r[1]) * scale};
+    const auto y{2 * r[0] * r[1] * scale};
+    r[0] = x + p.Center()[0];
+    r[1] = y + p.Center()[1];
+    return r;
+}
+
+template<Concept::NumericVector2Any T>
+auto UniformRing<T>::Generate(auto& g, std::span<T> out, const UniformRingParameter<T>& p) -> void {
+    // uniforms are drawn into a block on the stack
+    using VT = VectorValueType<T>;
+    constexpr std::size_t blockSize{256};
+    std::array<VT, blockSize> block;
+    for (std::size_t k{}; k < out.size(); k += blockSize) {
+        const auto n{std::min(blockSize, out.size() - k)};
+        Uniform<VT>{}.Generate(g, std::span{block}.first(n));
+        for (std::size_t i{}; i < n; ++i) {
+            const auto [sin, cos]{Math::internal::SinCos2PiOn01(block[i])};
+            auto& x{out[k + i]};
+            x[0] = p.Radius() * cos + p.CenterX();
+            x[1] = p.Radius() * sin + p.CenterY();
+        }
+    }
+}
+
+} // namespace Mustard::Math::Random::inline Distribution
@@ -15,3 +15,69 @@
 //
 // You should have received a copy of the GNU General Public License along with
 // Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Concept/MathVector.h++"
+#include "Mustard/Concept/NumericVector.h++"
+#include "Mustard/Math/Random/Distribution/UniformBall.h++"
+#include "Mustard/Math/Random/Distribution/UniformRectangle.h++"
+#include "Mustard/Math/Random/RandomNumberDistributionBase.h++"
+#include "Mustard/Math/internal/SinCos2PiOn01.h++"
+#include "Mustard/Utility/FunctionAttribute.h++"
+#include "Mustard/Utility/VectorValueType.h++"
+
+#include "CLHEP/Random/RandomEngine.h"
+
+#include "muc/array"
+#include "muc/math"
+#include "muc/utility"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+namespace Mustard::Math::Random::inline Distribution {
+
+/// @brief Generates 3D uniform random vector on a sphere surface, e.g. an
+/// isotropic direction by default. Same parameter as UniformBall.
+/// @tparam T The result vector type. It must be 3-dimensional.
+template<Concept::NumericVector3Any T = muc::array3d>
+class UniformSphere;
+
+template<Concept::NumericVector3Any T>
+using UniformSphereParameter = internal::BasicUniformBallParameter<T, UniformSphere>;
+
+template<Concept::NumericVector3Any T>
+class UniformSphere final : public internal::UniformBallBase<T, UniformSphere> {
+public:
+    using internal::UniformBallBase<T, UniformSphere>::UniformBallBase;
+
+    MUSTARD_ALWAYS_INLINE constexpr auto operator()(UniformRandomBitGenerator auto& g) -> auto { return Impl(g, this->fParameter); }
+    MUSTARD_ALWAYS_INLINE constexpr auto operator()(UniformRandomBitGenerator auto& g, const UniformSphereParameter<T>& p) -> auto { return Impl(g, p); }
+
+    MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g) -> auto { return Impl(g, this->fParameter); }
+    MUSTARD_ALWAYS_INLINE auto operator()(CLHEP::HepRandomEngine& g, const UniformSphereParameter<T>& p) -> auto { return Impl(g, p); }
+
+    /// @brief Fill with random numbers of the distribution, by a vectorizable
+    /// cylindrical kernel over a batch of uniform random numbers.
+    auto Generate(auto& g, std::span<T> out) -> void { Generate(g, out, this->fParameter); }
+    auto Generate(auto& g, std::span<T> out, const UniformSphereParameter<T>& p) -> void;
+
+private:
+    MUSTARD_ALWAYS_INLINE static constexpr auto Impl(auto& g, const UniformSphereParameter<T>& p) -> T;
+};
+
+template<typename VT, typename T>
+UniformSphere(VT, T) -> UniformSphere<std::enable_if_t<std::same_as<VT, VectorValueType<std::decay_t<T>>>, std::decay_t<T>>>;
+template<typename T, typename U, typename V, typename W>
+UniformSphere(T, U, V, W) -> UniformSphere<std::array<std::common_type_t<T, U, V, W>, 3>>;
+template<typename T>
+UniformSphere(T) -> UniformSphere<std::array<T, 3>>;
+
+} // namespace Mustard::Math::Random::inline Distribution
+
+#include "Mustard/Math/Random/Distribution/UniformSphere.inl"
@@ -15,3 +15,61 @@
 //
 // You should have received a copy of the GNU General Public License along with
 // Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Math::Random::inline Distribution {
+
+template<Concept::NumericVector3Any T>
+MUSTARD_ALWAYS_INLINE constexpr auto UniformSphere<T>::Impl(auto& g, const UniformSphereParameter<T>& p) -> T {
+    // G. Marsaglia, Ann. Math. Statist. 43 (1972) 645: (u, v) uniform in the
+    // unit disk maps to a uniform point on the unit sphere
+    using VT = VectorValueType<T>;
+    std::array<VT, 2> uv;
+    VT s;
+    do {
+        uv = UniformCompactRectangle<std::array<VT, 2>>({-1, 1}, {-1, 1})(g);
+        s = muc::hypot_sq(uv[0], uv[1]);
+        muc::assume(0 <= s and s <= 2);
+    } while (s >= 1);
+    const auto scale{2 * std::sqrt(1 - s)};
+    T r{uv[0] * scale, uv[1] * scale, 1 - 2 * s};
+    if constexpr (Concept::MathVector3Any<T>) {
+        r = p.Radius() * r + p.Center();
+    } else {
+        r[0] = p.Radius() * r[0] + p.Center()[0];
+        r[1] = p.Radius() * r[1] + p.Center()[1];
+        r[2] = p.Radius() * r[2] + p.Center()[2];
+    }
+    return r;
+}
+
+template<Concept::NumericVector3Any T>
+auto UniformSphere<T>::Generate(auto& g, std::span<T> out, const UniformSphereParameter<T>& p) -> void {
+    // Archimedes: z = 1 - 2u is uniform on [-1, 1], and the rest is on a circle
+    // of radius sqrt(1 - z^2) = 2 sqrt(u (1 - u)). Uniforms are drawn into a
+    // block on the stack.
+    using VT = VectorValueType<T>;
+    constexpr std::size_t blockSize{256};
+    std::array<VT, 3 * blockSize> block;
+    for (std::size_t k{}; k < out.size(); k += blockSize) {
+        const auto n{std::min(blockSize, out.size() - k)};
+        Uniform<VT>{}.Generate(g, std::span{block}.first(2 * n));
+        for (std::size_t i{}; i < n; ++i) {
+            const auto u{block[i]};
+            block[2 * n + i] = 4 * u * (1 - u);
+        }
+        // separated, as sqrt is not vectorized if it may set errno
+        for (std::size_t i{}; i < n; ++i) {
+            block[2 * n + i] = std::sqrt(block[2 * n + i]);
+        }
+        for (std::size_t i{}; i < n; ++i) {
+            const auto rho{p.Radius() * block[2 * n + i]};
+            const auto [sin, cos]{Math::internal::SinCos2PiOn01(block[n + i])};
+            auto& x{out[k + i]};
+            x[0] = rho * cos + p.CenterX();
+            x[1] = rho * sin + p.CenterY();
+            x[2] = p.Radius() * (1 - 2 * block[i]) + p.CenterZ();
+        }
+    }
+}
+
+} // namespace Mustard::Math::Random::inline Distribution
@@ -0,0 +1,80 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/Utility/FunctionAttribute.h++"
+
+#include "muc/concepts"
+
+#include "fmt/core.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <istream>
+#include <limits>
+#include <numeric>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace Mustard::Math::Random::inline Distribution::internal {
+
+/// @brief Walker's alias table of at most NMax entries, built in O(n) by Vose's
+/// algorithm, sampled in O(1). Trivially copyable.
+/// @note Reference: M. D. Vose, A Linear Algorithm for Generating Random
+/// Numbers with a Given Distribution, IEEE Trans. Softw. Eng. 17 (1991).
+template<std::size_t NMax>
+    requires(0 < NMax and NMax <= std::numeric_limits<std::uint32_t>::max())
+class AliasTable final {
+public:
+    /// @brief A table always returning 0.
+    constexpr AliasTable();
+    /// @brief Build from non-negative weights, not all zero.
+    explicit AliasTable(std::span<const double> weight);
+
+    constexpr auto Size() const -> std::size_t { return fSize; }
+
+    /// @brief Map a uniform in [0, 1) to an index in [0, Size()).
+    MUSTARD_ALWAYS_INLINE constexpr auto operator()(double u) const -> std::size_t;
+
+    template<muc::character AChar>
+    friend auto operator<<(std::basic_ostream<AChar>& os, const AliasTable& self) -> decltype(os) { return self.StreamOutput(os); }
+    template<muc::character AChar>
+    friend auto operator>>(std::basic_istream<AChar>& is, AliasTable& self) -> decltype(is) { return self.StreamInput(is); }
+
+private:
+    template<muc::character AChar>
+    auto StreamOutput(std::basic_ostream<AChar>& os) const -> decltype(os);
+    template<muc::character AChar>
+    auto StreamInput(std::basic_istream<AChar>& is) & -> decltype(is);
+
+private:
+    std::uint32_t fSize;
+    std::array<double, NMax> fProbability;
+    std::array<std::uint32_t, NMax> fAlias;
+};
+
+} // namespace Mustard::Math::Random::inline Distribution::internal
+
+#include "Mustard/Math/Random/Distribution/internal/AliasTable.inl"
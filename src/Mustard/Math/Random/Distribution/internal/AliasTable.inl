@@ -0,0 +1,117 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Math::Random::inline Distribution::internal {
+
+template<std::size_t NMax>
+    requires(0 < NMax and NMax <= std::numeric_limits<std::uint32_t>::max())
+constexpr AliasTable<NMax>::AliasTable() :
+    fSize{1},
+    fProbability{1},
+    fAlias{} {}
+
+template<std::size_t NMax>
+    requires(0 < NMax and NMax <= std::numeric_limits<std::uint32_t>::max())
+AliasTable<NMax>::AliasTable(std::span<const double> weight) :
+    fSize{static_cast<std::uint32_t>(weight.size())},
+    fProbability{},
+    fAlias{} {
+    if (weight.empty() or weight.size() > NMax) {
+        Throw<std::length_error>(fmt::format("Number of weights ({}) is not in [1, {}] (raise NMax)", weight.size(), NMax));
+    }
+    if (const auto invalid{std::ranges::find_if(weight, [](double w) { return not(0 <= w and w < std::numeric_limits<double>::infinity()); })};
+        invalid != weight.end()) {
+        Throw<std::invalid_argument>(fmt::format("Invalid weight ({}) at {}", *invalid, invalid - weight.begin()));
+    }
+    const auto sum{std::reduce(weight.begin(), weight.end())};
+    if (sum == 0) {
+        Throw<std::invalid_argument>("All weights are zero");
+    }
+    // scaled to mean 1, then each underfull entry is topped up by an overfull one
+    std::vector<std::uint32_t> small;
+    std::vector<std::uint32_t> large;
+    for (std::uint32_t i{}; i < fSize; ++i) {
+        fProbability[i] = weight[i] / sum * fSize;
+        (fProbability[i] < 1 ? small : large).push_back(i);
+    }
+    while (not small.empty() and not large.empty()) {
+        const auto s{small.back()};
+        small.pop_back();
+        const auto l{large.back()};
+        fAlias[s] = l;
+        fProbability[l] -= 1 - fProbability[s];
+        if (fProbability[l] < 1) {
+            large.pop_back();
+            small.push_back(l);
+        }
+    }
+    // left over by rounding, so full up to round-off, but a zero weight must
+    // stay unreachable: send its whole column to a positive weight
+    const auto positive{static_cast<std::uint32_t>(std::ranges::find_if(weight, [](double w) { return w > 0; }) - weight.begin())};
+    for (auto i : small) {
+        if (weight[i] > 0) {
+            fProbability[i] = 1;
+        } else {
+            fProbability[i] = 0;
+            fAlias[i] = positive;
+        }
+    }
+    for (auto i : large) {
+        fProbability[i] = 1;
+    }
+}
+
+template<std::size_t NMax>
+    requires(0 < NMax and NMax <= std::numeric_limits<std::uint32_t>::max())
+MUSTARD_ALWAYS_INLINE constexpr auto AliasTable<NMax>::operator()(double u) const -> std::size_t {
+    const auto scaled{u * fSize};
+    const auto i{std::min(static_cast<std::uint32_t>(scaled), fSize - 1)};
+    return scaled - i < fProbability[i] ? i : fAlias[i];
+}
+
+template<std::size_t NMax>
+    requires(0 < NMax and NMax <= std::numeric_limits<std::uint32_t>::max())
+template<muc::character AChar>
+auto AliasTable<NMax>::StreamOutput(std::basic_ostream<AChar>& os) const -> decltype(os) {
+    const auto oldPrecision{os.precision(std::numeric_limits<double>::max_digits10)};
+    os << fSize;
+    for (std::uint32_t i{}; i < fSize; ++i) {
+        os << ' ' << fProbability[i] << ' ' << fAlias[i];
+    }
+    return os << std::setprecision(oldPrecision);
+}
+
+template<std::size_t NMax>
+    requires(0 < NMax and NMax <= std::numeric_limits<std::uint32_t>::max())
+template<muc::character AChar>
+auto AliasTable<NMax>::StreamInput(std::basic_istream<AChar>& is) & -> decltype(is) {
+    AliasTable table;
+    if (not(is >> table.fSize) or table.fSize == 0 or table.fSize > NMax) {
+        is.setstate(std::ios::failbit);
+        return is;
+    }
+    for (std::uint32_t i{}; i < table.fSize; ++i) {
+        is >> table.fProbability[i] >> table.fAlias[i];
+    }
+    if (is) {
+        *this = table;
+    }
+    return is;
+}
+
+} // namespace Mustard::Math::Random::inline Distribution::internal
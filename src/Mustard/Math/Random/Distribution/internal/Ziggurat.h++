@@ -0,0 +1,84 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Math/Random/Distribution/Uniform.h++"
+#include "Mustard/Utility/FunctionAttribute.h++"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace Mustard::Math::Random::inline Distribution::internal {
+
+/// @brief Ziggurat of N layers of equal area v under a decreasing density f
+/// on [0, inf), with tail beyond r. Tables are built at compile time.
+/// @details Layer i spans [0, x[i]) horizontally and [f(x[i]), f(x[i + 1]))
+/// vertically, where x[0] = v / f(r) (the base layer and the tail), x[1] = r,
+/// and x[N] = 0. A sample x = u x[i] within [0, x[i + 1]) is accepted
+/// immediately, which is the case for most samples.
+/// @note Reference: G. Marsaglia and W. W. Tsang, The Ziggurat Method for
+/// Generating Random Variables, J. Stat. Softw. 5 (2000); J. A. Doornik, An
+/// Improved Ziggurat Method to Generate Normal Random Samples (2005). The
+/// layer index and the uniform come from independent bits of a draw, as
+/// suggested by Doornik.
+/// @tparam T The value type.
+/// @tparam N The number of layers.
+template<std::floating_point T, std::size_t N>
+    requires(std::has_single_bit(N))
+class Ziggurat final {
+public:
+    /// @param r The start of the tail.
+    /// @param v The area of each layer.
+    /// @param f The density (unnormalized), evaluated at compile time.
+    /// @param inverseF The inverse of f, evaluated at compile time.
+    consteval Ziggurat(long double r, long double v, auto f, auto inverseF);
+
+    constexpr auto R() const -> T { return fX[1]; }
+    constexpr auto X() const -> const auto& { return fX; }
+    constexpr auto F() const -> const auto& { return fF; }
+
+    /// @brief Draw a sample of the density on [0, inf), or on (-inf, inf) if
+    /// symmetric.
+    /// @param density The density (unnormalized), evaluated in wedges.
+    /// @param tail Samples the tail, given the generator and the uniform
+    /// whose sign is that of the result in the symmetric case.
+    template<bool ASymmetric>
+    MUSTARD_ALWAYS_INLINE constexpr auto Sample(auto& g, auto density, auto tail) const -> T;
+
+private:
+    /// @brief A layer index, and a uniform in [0, 1) or [-1, 1) if symmetric.
+    template<bool ASymmetric>
+    MUSTARD_ALWAYS_INLINE static constexpr auto Draw(auto& g) -> std::pair<std::size_t, T>;
+
+private:
+    std::array<T, N + 1> fX;
+    std::array<T, N + 1> fF;
+};
+
+} // namespace Mustard::Math::Random::inline Distribution::internal
+
+#include "Mustard/Math/Random/Distribution/internal/Ziggurat.inl"
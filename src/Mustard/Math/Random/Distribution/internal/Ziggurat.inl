@@ -0,0 +1,84 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Math::Random::inline Distribution::internal {
+
+template<std::floating_point T, std::size_t N>
+    requires(std::has_single_bit(N))
+consteval Ziggurat<T, N>::Ziggurat(long double r, long double v, auto f, auto inverseF) :
+    fX{},
+    fF{} {
+    std::array<long double, N + 1> x{};
+    x[0] = v / f(r);
+    x[1] = r;
+    for (std::size_t i{1}; i < N - 1; ++i) {
+        x[i + 1] = inverseF(f(x[i]) + v / x[i]);
+    }
+    x[N] = 0;
+    for (std::size_t i{}; i <= N; ++i) {
+        fX[i] = x[i];
+        fF[i] = f(x[i]);
+    }
+}
+
+template<std::floating_point T, std::size_t N>
+    requires(std::has_single_bit(N))
+template<bool ASymmetric>
+MUSTARD_ALWAYS_INLINE constexpr auto Ziggurat<T, N>::Sample(auto& g, auto density, auto tail) const -> T {
+    while (true) {
+        const auto [i, u]{Draw<ASymmetric>(g)};
+        const auto x{u * fX[i]};
+        if ((ASymmetric ? std::abs(x) : x) < fX[i + 1]) [[likely]] {
+            return x;
+        }
+        if (i == 0) {
+            return tail(g, u);
+        }
+        static_assert(Uniform<T>::Stateless());
+        if (fF[i] + (fF[i + 1] - fF[i]) * Uniform<T>{}(g) < density(x)) {
+            return x;
+        }
+    }
+}
+
+template<std::floating_point T, std::size_t N>
+    requires(std::has_single_bit(N))
+template<bool ASymmetric>
+MUSTARD_ALWAYS_INLINE constexpr auto Ziggurat<T, N>::Draw(auto& g) -> std::pair<std::size_t, T> {
+    using G = std::remove_cvref_t<decltype(g)>;
+    constexpr auto nIndexBit{std::countr_zero(N)};
+    constexpr auto nUniformBit{std::numeric_limits<T>::digits};
+    if constexpr (requires {
+                      requires std::same_as<typename G::ResultType, std::uint64_t>;
+                      requires G::Min() == 0 and G::Max() == std::numeric_limits<std::uint64_t>::max();
+                  } and nIndexBit + nUniformBit <= 64) {
+        // index from low bits, uniform from high bits
+        const auto bits{g()};
+        const auto i{static_cast<std::size_t>(bits & (N - 1))};
+        constexpr auto scale{static_cast<T>(ASymmetric ? 2 : 1) / static_cast<T>(std::uint64_t{1} << nUniformBit)};
+        const auto u{static_cast<T>(bits >> (64 - nUniformBit)) * scale};
+        return {i, ASymmetric ? u - 1 : u};
+    } else {
+        static_assert(UniformCompact<T>::Stateless());
+        const auto i{std::min(static_cast<std::size_t>(UniformCompact<T>{}(g) * N), N - 1)};
+        const auto u{UniformCompact<T>{}(g)};
+        return {i, ASymmetric ? 2 * u - 1 : u};
+    }
+}
+
+} // namespace Mustard::Math::Random::inline Distribution::internal
@@ -0,0 +1,87 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Math/Random/UniformPseudoRandomBitGeneratorBase.h++"
+#include "Mustard/Utility/FunctionAttribute.h++"
+
+#include "muc/concepts"
+
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+
+namespace Mustard::Math::Random::inline Generator {
+
+/// @brief Philox4x64-10 counter-based generator (Salmon et al., SC'11).
+///
+/// Output block n is a keyed bijection of a 256-bit counter, so any position
+/// of any stream is reachable in O(1). The seed is the first key word. The
+/// counter is (position low, position high, stream low, stream high), so
+/// Stream(a, b) selects one of 2^128 independent streams of 2^130 numbers,
+/// e.g. Stream(run, task) gives each task of a run its own stream.
+class Philox4x64 final : public UniformPseudoRandomBitGeneratorBase<Philox4x64,
+                                                                    std::uint64_t,
+                                                                    std::uint64_t> {
+public:
+    constexpr Philox4x64();
+    constexpr explicit Philox4x64(SeedType seed);
+
+    MUSTARD_ALWAYS_INLINE constexpr auto operator()() -> ResultType;
+    /// @brief Set the key and restart the current stream.
+    constexpr auto Seed(SeedType seed) -> void;
+    /// @brief Jump to the beginning of stream (stream0, stream1), key unchanged.
+    constexpr auto Stream(std::uint64_t stream0, std::uint64_t stream1) -> void;
+    /// @brief Skip n numbers in O(1).
+    constexpr auto Discard(unsigned long long n) -> void;
+
+    static constexpr auto Min() -> auto { return std::numeric_limits<ResultType>::min(); }
+    static constexpr auto Max() -> auto { return std::numeric_limits<ResultType>::max(); }
+
+    /// @brief The Philox4x64-10 bijection.
+    static constexpr auto Block(std::array<std::uint64_t, 4> counter, std::array<std::uint64_t, 2> key) -> std::array<std::uint64_t, 4>;
+
+    constexpr auto operator==(const Philox4x64&) const -> bool = default;
+
+    template<muc::character AChar>
+    friend auto operator<<(std::basic_ostream<AChar>& os, const Philox4x64& self) -> decltype(os) { return self.StreamOutput(os); }
+    template<muc::character AChar>
+    friend auto operator>>(std::basic_istream<AChar>& is, Philox4x64& self) -> decltype(is) { return self.StreamInput(is); }
+
+private:
+    template<muc::character AChar>
+    auto StreamOutput(std::basic_ostream<AChar>& os) const -> decltype(os);
+    template<muc::character AChar>
+    auto StreamInput(std::basic_istream<AChar>& is) & -> decltype(is);
+
+    static constexpr auto MulHiLo(std::uint64_t a, std::uint64_t b) -> std::array<std::uint64_t, 2>;
+
+private:
+    std::array<std::uint64_t, 2> fKey;
+    // counter of the next block
+    std::array<std::uint64_t, 4> fCounter;
+    std::array<std::uint64_t, 4> fBlock;
+    std::uint64_t fIndex;
+};
+
+} // namespace Mustard::Math::Random::inline Generator
+
+#include "Mustard/Math/Random/Generator/Philox4x64.inl"
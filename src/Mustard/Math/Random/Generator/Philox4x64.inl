@@ -0,0 +1,124 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Math::Random::inline Generator {
+
+constexpr Philox4x64::Philox4x64() :
+    UniformPseudoRandomBitGeneratorBase{},
+    fKey{0x1BCC2859AEA0EE4Dull, 0},
+    fCounter{},
+    fBlock{},
+    fIndex{4} {}
+
+constexpr Philox4x64::Philox4x64(Philox4x64::SeedType seed) :
+    UniformPseudoRandomBitGeneratorBase{},
+    fKey{},
+    fCounter{},
+    fBlock{},
+    fIndex{4} {
+    Seed(seed);
+}
+
+MUSTARD_ALWAYS_INLINE constexpr auto Philox4x64::operator()() -> Philox4x64::ResultType {
+    if (fIndex == 4) [[unlikely]] {
+        fBlock = Block(fCounter, fKey);
+        fIndex = 0;
+        fCounter[1] += ++fCounter[0] == 0;
+    }
+    return fBlock[fIndex++];
+}
+
+constexpr auto Philox4x64::Seed(Philox4x64::SeedType seed) -> void {
+    fKey = {seed, 0};
+    fCounter[0] = 0;
+    fCounter[1] = 0;
+    fIndex = 4;
+}
+
+constexpr auto Philox4x64::Stream(std::uint64_t stream0, std::uint64_t stream1) -> void {
+    fCounter = {0, 0, stream0, stream1};
+    fIndex = 4;
+}
+
+constexpr auto Philox4x64::Discard(unsigned long long n) -> void {
+    const auto nBuffered{4 - fIndex};
+    if (n <= nBuffered) {
+        fIndex += n;
+        return;
+    }
+    n -= nBuffered;
+    const auto nBlock{n / 4};
+    fCounter[1] += (fCounter[0] += nBlock) < nBlock;
+    fIndex = 4;
+    if (const auto remainder{n % 4}; remainder != 0) {
+        (*this)();
+        fIndex = remainder;
+    }
+}
+
+constexpr auto Philox4x64::Block(std::array<std::uint64_t, 4> counter, std::array<std::uint64_t, 2> key) -> std::array<std::uint64_t, 4> {
+    constexpr std::uint64_t m0{0xD2E7470EE14C6C93ull};
+    constexpr std::uint64_t m1{0xCA5A826395121157ull};
+    constexpr std::uint64_t w0{0x9E3779B97F4A7C15ull};
+    constexpr std::uint64_t w1{0xBB67AE8584CAA73Bull};
+    for (int round{}; round < 10; ++round) {
+        const auto [hi0, lo0]{MulHiLo(m0, counter[0])};
+        const auto [hi1, lo1]{MulHiLo(m1, counter[2])};
+        counter = {hi1 ^ counter[1] ^ key[0], lo1, hi0 ^ counter[3] ^ key[1], lo0};
+        key[0] += w0;
+        key[1] += w1;
+    }
+    return counter;
+}
+
+template<muc::character AChar>
+auto Philox4x64::StreamOutput(std::basic_ostream<AChar>& os) const -> decltype(os) {
+    return os << fKey[0] << ' ' << fKey[1] << ' '
+              << fCounter[0] << ' ' << fCounter[1] << ' ' << fCounter[2] << ' ' << fCounter[3] << ' '
+              << fBlock[0] << ' ' << fBlock[1] << ' ' << fBlock[2] << ' ' << fBlock[3] << ' '
+              << fIndex;
+}
+
+template<muc::character AChar>
+auto Philox4x64::StreamInput(std::basic_istream<AChar>& is) & -> decltype(is) {
+    return is >> fKey[0] >> fKey[1] // clang-format off
+              >> fCounter[0] >> fCounter[1] >> fCounter[2] >> fCounter[3]
+              >> fBlock[0] >> fBlock[1] >> fBlock[2] >> fBlock[3]
+              >> fIndex; // clang-format on
+}
+
+constexpr auto Philox4x64::MulHiLo(std::uint64_t a, std::uint64_t b) -> std::array<std::uint64_t, 2> {
+#if defined __SIZEOF_INT128__
+    __extension__ using UInt128 = unsigned __int128;
+    const auto product{static_cast<UInt128>(a) * b};
+    return {static_cast<std::uint64_t>(product >> 64), static_cast<std::uint64_t>(product)};
+#else
+    const auto aLo{a & 0xFFFFFFFFull};
+    const auto aHi{a >> 32};
+    const auto bLo{b & 0xFFFFFFFFull};
+    const auto bHi{b >> 32};
+    const auto ll{aLo * bLo};
+    const auto lh{aLo * bHi};
+    const auto hl{aHi * bLo};
+    const auto hh{aHi * bHi};
+    const auto middle{(ll >> 32) + (lh & 0xFFFFFFFFull) + (hl & 0xFFFFFFFFull)};
+    return {hh + (lh >> 32) + (hl >> 32) + (middle >> 32), a * b};
+#endif
+}
+
+} // namespace Mustard::Math::Random::inline Generator
@@ -23,6 +23,7 @@
 
 #include "muc/concepts"
 
+#include <array>
 #include <bit>
 #include <concepts>
 #include <cstdint>
@@ -40,6 +41,10 @@ protected:
 
 public:
     MUSTARD_ALWAYS_INLINE constexpr auto Step() -> void;
+    /// @brief Advance by 2^128 steps.
+    constexpr auto Jump() -> void { this->JumpBy(fgJumpPolynomial); }
+    /// @brief Advance by 2^192 steps.
+    constexpr auto LongJump() -> void { this->JumpBy(fgLongJumpPolynomial); }
 
     template<muc::character AChar>
     friend auto operator<<(std::basic_ostream<AChar>& os, const Xoshiro256Base& self) -> decltype(os) { return self.StreamOutput(os); }
@@ -51,6 +56,16 @@ private:
     auto StreamOutput(std::basic_ostream<AChar>& os) const -> decltype(os);
     template<muc::character AChar>
     auto StreamInput(std::basic_istream<AChar>& is) & -> decltype(is);
+
+private: // clang-format off
+    static constexpr std::array<std::uint64_t, 4> fgJumpPolynomial{0x180EC6D33CFD0ABAull,
+                                                                   0xD5A61266F0C9392Cull,
+                                                                   0xA9582618E03FC9AAull,
+                                                                   0x39ABDC4529B1661Cull};
+    static constexpr std::array<std::uint64_t, 4> fgLongJumpPolynomial{0x76E15D3EFEFDCBBFull,
+                                                                       0xC5004E441C522FB3ull,
+                                                                       0x77710069854EE241ull,
+                                                                       0x39109BB02ACBE635ull}; // clang-format on
 };
 
 } // namespace Mustard::Math::Random::inline Generator
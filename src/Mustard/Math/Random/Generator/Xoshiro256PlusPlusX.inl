@@ -0,0 +1,182 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+namespace Mustard::Math::Random::inline Generator {
+
+template<std::size_t NLane>
+    requires(NLane == 2 or NLane == 4 or NLane == 8)
+constexpr Xoshiro256PlusPlusX<NLane>::Xoshiro256PlusPlusX() :
+    UniformPseudoRandomBitGeneratorBase<Xoshiro256PlusPlusX<NLane>, std::uint64_t, std::uint64_t>{},
+    fState{},
+    fBlock{},
+    fIndex{NLane} {
+    Initialize(Xoshiro256PlusPlus{});
+}
+
+template<std::size_t NLane>
+    requires(NLane == 2 or NLane == 4 or NLane == 8)
+constexpr Xoshiro256PlusPlusX<NLane>::Xoshiro256PlusPlusX(SeedType seed) :
+    UniformPseudoRandomBitGeneratorBase<Xoshiro256PlusPlusX<NLane>, std::uint64_t, std::uint64_t>{},
+    fState{},
+    fBlock{},
+    fIndex{NLane} {
+    Seed(seed);
+}
+
+template<std::size_t NLane>
+    requires(NLane == 2 or NLane == 4 or NLane == 8)
+MUSTARD_ALWAYS_INLINE constexpr auto Xoshiro256PlusPlusX<NLane>::operator()() -> ResultType {
+    if (fIndex == NLane) [[unlikely]] {
+        Next(fBlock);
+        fIndex = 0;
+    }
+    return fBlock[fIndex++];
+}
+
+template<std::size_t NLane>
+    requires(NLane == 2 or NLane == 4 or NLane == 8)
+constexpr auto Xoshiro256PlusPlusX<NLane>::Seed(SeedType seed) -> void {
+    Initialize(Xoshiro256PlusPlus{seed});
+}
+
+template<std::size_t NLane>
+    requires(NLane == 2 or NLane == 4 or NLane == 8)
+constexpr auto Xoshiro256PlusPlusX<NLane>::operator==(const Xoshiro256PlusPlusX& that) const -> bool {
+    if (fIndex != that.fIndex) {
+        return false;
+    }
+    for (std::size_t i{}; i < NLane; ++i) {
+        for (std::size_t j{}; j < 4; ++j) {
+            if (fState[j][i] != that.fState[j][i]) {
+                return false;
+            }
+        }
+    }
+    // consumed numbers of the current block do not matter
+    for (auto i{fIndex}; i < NLane; ++i) {
+        if (fBlock[i] != that.fBlock[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<std::size_t NLane>
+    requires(NLane == 2 or NLane == 4 or NLane == 8)
+constexpr auto Xoshiro256PlusPlusX<NLane>::Initialize(Xoshiro256PlusPlus xoshiro) -> void {
+    std::array<std::array<std::uint64_t, NLane>, 4> state;
+    for (std::size_t i{}; i < NLane; ++i) {
+        for (std::size_t j{}; j < 4; ++j) {
+            state[j][i] = xoshiro.State()[j];
+        }
+        xoshiro.Jump();
+    }
+    for (std::size_t j{}; j < 4; ++j) {
+        Load(fState[j], state[j]);
+    }
+    fIndex = NLane;
+}
+
+template<std::size_t NLane>
+    requires(NLane == 2 or NLane == 4 or NLane == 8)
+constexpr auto Xoshiro256PlusPlusX<NLane>::Load(Vector& vector, const std::array<std::uint64_t, NLane>& word) -> void {
+    // vector elements cannot be assigned in constant evaluation, nor addressed
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        vector = Vector{word[I]...};
+    }(std::make_index_sequence<NLane>{});
+}
+
+template<std::size_t NLane>
+    requires(NLane == 2 or NLane == 4 or NLane == 8)
+MUSTARD_ALWAYS_INLINE constexpr auto Xoshiro256PlusPlusX<NLane>::Next(Vector& block) -> void {
+    auto& [s0, s1, s2, s3]{fState};
+    const auto sum{s0 + s3};
+    block = (sum << 23 | sum >> 41) + s0;
+
+    const auto t{s1 << 17};
+
+    s2 ^= s0;
+    s3 ^= s1;
+    s1 ^= s2;
+    s0 ^= s3;
+
+    s2 ^= t;
+
+    s3 = s3 << 45 | s3 >> 19;
+}
+
+template<std::size_t NLane>
+    requires(NLane == 2 or NLane == 4 or NLane == 8)
+template<typename T>
+MUSTARD_ALWAYS_INLINE constexpr auto Xoshiro256PlusPlusX<NLane>::FillImpl(std::span<T> out, auto Convert) -> void {
+    std::size_t k{};
+    // rest of the current block
+    for (; fIndex < NLane and k < out.size(); ++k) {
+        out[k] = Convert(fBlock[fIndex++]);
+    }
+    // whole blocks
+    for (; out.size() - k >= NLane; k += NLane) {
+        Vector block;
+        Next(block);
+        for (std::size_t i{}; i < NLane; ++i) {
+            out[k + i] = Convert(block[i]);
+        }
+    }
+    // head of the next block (less than NLane numbers)
+    for (std::size_t i{}; i < NLane and k < out.size(); ++i, ++k) {
+        out[k] = Convert((*this)());
+    }
+}
+
+template<std::size_t NLane>
+    requires(NLane == 2 or NLane == 4 or NLane == 8)
+template<muc::character AChar>
+auto Xoshiro256PlusPlusX<NLane>::StreamOutput(std::basic_ostream<AChar>& os) const -> decltype(os) {
+    for (std::size_t i{}; i < NLane; ++i) {
+        for (std::size_t j{}; j < 4; ++j) {
+            os << fState[j][i] << ' ';
+        }
+    }
+    for (std::size_t i{}; i < NLane; ++i) {
+        os << fBlock[i] << ' ';
+    }
+    return os << fIndex;
+}
+
+template<std::size_t NLane>
+    requires(NLane == 2 or NLane == 4 or NLane == 8)
+template<muc::character AChar>
+auto Xoshiro256PlusPlusX<NLane>::StreamInput(std::basic_istream<AChar>& is) & -> decltype(is) {
+    std::array<std::array<std::uint64_t, NLane>, 4> state;
+    for (std::size_t i{}; i < NLane; ++i) {
+        for (std::size_t j{}; j < 4; ++j) {
+            is >> state[j][i];
+        }
+    }
+    std::array<std::uint64_t, NLane> block;
+    for (auto&& r : block) {
+        is >> r;
+    }
+    for (std::size_t j{}; j < 4; ++j) {
+        Load(fState[j], state[j]);
+    }
+    Load(fBlock, block);
+    return is >> fIndex;
+}
+
+} // namespace Mustard::Math::Random::inline Generator
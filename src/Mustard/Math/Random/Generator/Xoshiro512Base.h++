@@ -23,6 +23,7 @@
 
 #include "muc/concepts"
 
+#include <array>
 #include <bit>
 #include <concepts>
 #include <cstdint>
@@ -40,6 +41,10 @@ protected:
 
 public:
     MUSTARD_ALWAYS_INLINE constexpr auto Step() -> void;
+    /// @brief Advance by 2^256 steps.
+    constexpr auto Jump() -> void { this->JumpBy(fgJumpPolynomial); }
+    /// @brief Advance by 2^384 steps.
+    constexpr auto LongJump() -> void { this->JumpBy(fgLongJumpPolynomial); }
 
     template<muc::character AChar>
     friend auto operator<<(std::basic_ostream<AChar>& os, const Xoshiro512Base& self) -> decltype(os) { return self.StreamOutput(os); }
@@ -51,6 +56,24 @@ private:
     auto StreamOutput(std::basic_ostream<AChar>& os) const -> decltype(os);
     template<muc::character AChar>
     auto StreamInput(std::basic_istream<AChar>& is) & -> decltype(is);
+
+private: // clang-format off
+    static constexpr std::array<std::uint64_t, 8> fgJumpPolynomial{0x33ED89B6E7A353F9ull,
+                                                                   0x760083D7955323BEull,
+                                                                   0x2837F2FBB5F22FAEull,
+                                                                   0x4B8C5674D309511Cull,
+                                                                   0xB11AC47A7BA28C25ull,
+                                                                   0xF1BE7667092BCC1Cull,
+                                                                   0x53851EFDB6DF0AAFull,
+                                                                   0x1EBBC8B23EAF25DBull};
+    static constexpr std::array<std::uint64_t, 8> fgLongJumpPolynomial{0x11467FEF8F921D28ull,
+                                                                       0xA2A819F2E79C8EA8ull,
+                                                                       0xA8299FC284B3959Aull,
+                                                                       0xB4D347340CA63EE1ull,
+                                                                       0x1CB0940BEDBFF6CEull,
+                                                                       0xD956C5C4FA1F8E17ull,
+                                                                       0x915E38FD4EDA93BCull,
+                                                                       0x5B3CCDFA5D7DACA5ull}; // clang-format on
 };
 
 } // namespace Mustard::Math::Random::inline Generator
@@ -25,6 +25,7 @@
 #include <array>
 #include <concepts>
 #include <cstdint>
+#include <functional>
 #include <limits>
 #include <utility>
 
@@ -43,9 +44,22 @@ protected:
 public:
     constexpr auto Seed(std::uint64_t seed) -> void;
 
+    /// @brief Generator of the n-th substream following the current state.
+    /// @details Substreams are separated by Jump() (2^(NBit/2) steps) and are
+    /// therefore disjoint. E.g., Split(i) for worker i of n workers. Takes n
+    /// jumps, combine with LongJump() to cover larger index spaces.
+    constexpr auto Split(std::uint64_t n) const -> ADerived;
+
+    /// @brief Raw state words, e.g. to initialize interleaved lanes.
+    constexpr auto State() const -> const auto& { return fState; }
+
     static constexpr auto Min() -> auto { return std::numeric_limits<std::uint64_t>::min(); }
     static constexpr auto Max() -> auto { return std::numeric_limits<std::uint64_t>::max(); }
 
+protected:
+    /// @brief Advance by the number of steps encoded in a jump polynomial.
+    constexpr auto JumpBy(const std::array<std::uint64_t, NBit / 64>& polynomial) -> void;
+
 protected:
     std::array<std::uint64_t, NBit / 64> fState;
 };
@@ -44,4 +44,29 @@ constexpr auto XoshiroBase<ADerived, NBit>::Seed(std::uint64_t seed) -> void {
     static_cast<ADerived*>(this)->Step();
 }
 
+template<typename ADerived, std::size_t NBit>
+    requires(NBit % 64 == 0)
+constexpr auto XoshiroBase<ADerived, NBit>::Split(std::uint64_t n) const -> ADerived {
+    auto split{static_cast<const ADerived&>(*this)};
+    for (std::uint64_t i{}; i < n; ++i) {
+        split.Jump();
+    }
+    return split;
+}
+
+template<typename ADerived, std::size_t NBit>
+    requires(NBit % 64 == 0)
+constexpr auto XoshiroBase<ADerived, NBit>::JumpBy(const std::array<std::uint64_t, NBit / 64>& polynomial) -> void {
+    std::array<std::uint64_t, NBit / 64> state{};
+    for (auto&& word : polynomial) {
+        for (int b{}; b < 64; ++b) {
+            if (word & 1ull << b) {
+                std::ranges::transform(state, fState, state.begin(), std::bit_xor{});
+            }
+            static_cast<ADerived*>(this)->Step();
+        }
+    }
+    fState = state;
+}
+
 } // namespace Mustard::Math::Random::inline Generator
@@ -221,7 +221,8 @@ concept RandomNumberDistribution = requires(D d, const D x) {
     // 2.8. Given x, a (possibly const) value of D, expression
     // x.Parameter() must be valid and its value type is D::ParameterType. Expression
     // x.Parameter() returns p such that D(p).Parameter() == p.
-    { x.Parameter() } -> std::same_as<typename D::ParameterType>;
+    // -- Relaxed, allow returning a const reference to a large parameter.
+    requires std::same_as<std::remove_cvref_t<decltype(x.Parameter())>, typename D::ParameterType>;
     // 2.9. Given d, a value of D, and given p, a (possibly const)
     // value of type D::ParameterType, expression d.Parameter(p) must be
     // valid and its value type is void. The postcondition of d.Parameter(p) is
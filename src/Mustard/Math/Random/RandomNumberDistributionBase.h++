@@ -21,6 +21,7 @@
 #include "Mustard/Concept/NumericVector.h++"
 #include "Mustard/Math/Random/RandomNumberDistribution.h++"
 
+#include <span>
 #include <type_traits>
 
 namespace Mustard::Math::Random {
@@ -61,6 +62,12 @@ public:
     auto min() const -> auto { return static_cast<const ADerived*>(this)->Min(); }
     auto max() const -> auto { return static_cast<const ADerived*>(this)->Max(); }
 
+    /// @brief Fill with random numbers of the distribution. This default
+    /// invokes operator() for each element. Distributions with batch kernels
+    /// shadow it, in which case the sequence differs from that of operator().
+    auto Generate(auto& g, std::span<T> out) -> void;
+    auto Generate(auto& g, std::span<T> out, const AParameter& p) -> void;
+
     constexpr auto operator==(const RandomNumberDistributionBase&) const -> bool = default;
     constexpr auto operator<=>(const RandomNumberDistributionBase&) const -> auto = delete;
 };
@@ -31,4 +31,20 @@ constexpr RandomNumberDistributionBase<ADerived, AParameter, T>::RandomNumberDis
     static_assert(std::is_final_v<ADerived>);
 }
 
+template<typename ADerived, typename AParameter, typename T>
+    requires(std::is_arithmetic_v<T> or Concept::NumericVectorAny<T>)
+auto RandomNumberDistributionBase<ADerived, AParameter, T>::Generate(auto& g, std::span<T> out) -> void {
+    for (auto&& x : out) {
+        x = (*static_cast<ADerived*>(this))(g);
+    }
+}
+
+template<typename ADerived, typename AParameter, typename T>
+    requires(std::is_arithmetic_v<T> or Concept::NumericVectorAny<T>)
+auto RandomNumberDistributionBase<ADerived, AParameter, T>::Generate(auto& g, std::span<T> out, const AParameter& p) -> void {
+    for (auto&& x : out) {
+        x = (*static_cast<ADerived*>(this))(g, p);
+    }
+}
+
 } // namespace Mustard::Math::Random
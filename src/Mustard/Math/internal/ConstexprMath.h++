@@ -0,0 +1,93 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cassert>
+#include <concepts>
+#include <limits>
+#include <numbers>
+
+namespace Mustard::Math::internal {
+
+/// @brief exp(x), usable in constant evaluation (e.g. building tables). Not
+/// meant for run time.
+template<std::floating_point T>
+constexpr auto ConstexprExp(T x) -> T {
+    // x = k ln2 + r, |r| <= ln2 / 2
+    const auto k{static_cast<long long>(x / std::numbers::ln2_v<T> + (x < 0 ? -0.5 : 0.5))};
+    const auto r{x - k * std::numbers::ln2_v<T>};
+    // |r|^30 / 30! < 10^-45
+    T sum{1};
+    T term{1};
+    for (int n{1}; n <= 30; ++n) {
+        term *= r / n;
+        sum += term;
+    }
+    for (auto i{k}; i > 0; --i) {
+        sum *= 2;
+    }
+    for (auto i{k}; i < 0; ++i) {
+        sum /= 2;
+    }
+    return sum;
+}
+
+/// @brief log(x) for x > 0, usable in constant evaluation (e.g. building
+/// tables). Not meant for run time.
+template<std::floating_point T>
+constexpr auto ConstexprLog(T x) -> T {
+    assert(x > 0);
+    // x = 2^e m, 1/2 <= m < 1
+    int e{};
+    for (; x >= 1; ++e) {
+        x /= 2;
+    }
+    for (; x < static_cast<T>(0.5); --e) {
+        x *= 2;
+    }
+    // log(m) = 2 atanh(s), s = (m - 1) / (m + 1)
+    const auto s{(x - 1) / (x + 1)};
+    const auto s2{s * s};
+    // |s| <= 1/3, |s|^81 < 10^-38
+    T sum{};
+    T power{s};
+    for (int n{1}; n <= 81; n += 2) {
+        sum += power / n;
+        power *= s2;
+    }
+    return 2 * sum + e * std::numbers::ln2_v<T>;
+}
+
+/// @brief sqrt(x) for x >= 0, usable in constant evaluation (e.g. building
+/// tables). Not meant for run time.
+template<std::floating_point T>
+constexpr auto ConstexprSqrt(T x) -> T {
+    assert(x >= 0);
+    if (x == 0) {
+        return 0;
+    }
+    // Newton iterations decrease monotonically from above
+    auto y{x < 1 ? T{1} : x};
+    for (auto next{(y + x / y) / 2}; next < y; next = (y + x / y) / 2) {
+        y = next;
+    }
+    return y;
+}
+
+} // namespace Mustard::Math::internal
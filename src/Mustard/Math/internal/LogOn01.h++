@@ -0,0 +1,67 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Utility/FunctionAttribute.h++"
+
+#include "muc/utility"
+
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+
+namespace Mustard::Math::internal {
+
+/// @brief Full-precision log on (0, 1], written without branches or table
+/// lookups so that loops over it are vectorized.
+/// @note Reference: fdlibm e_log.c. x = 2^k (1 + f) with sqrt(2)/2 <= 1 + f <
+/// sqrt(2), and log(1 + f) is evaluated by a minimax polynomial in
+/// s = f / (2 + f). The error is less than 1 ulp for normal x.
+template<std::floating_point T>
+MUSTARD_ALWAYS_INLINE constexpr auto LogOn01(T x) -> T {
+    assert(0 < x and x <= 1);
+    muc::assume(0 < x and x <= 1);
+    if constexpr (std::same_as<T, float> and std::numeric_limits<double>::is_iec559) {
+        return static_cast<float>(LogOn01<double>(x));
+    } else if constexpr (std::same_as<T, double> and std::numeric_limits<double>::is_iec559) {
+        constexpr std::uint64_t sqrtHalfHigh{0x3FE6A09E00000000};
+        const auto xBits{std::bit_cast<std::uint64_t>(x) + (0x3FF0000000000000 - sqrtHalfHigh)};
+        const auto k{static_cast<double>(static_cast<int>(xBits >> 52) - 1023)};
+        const auto f{std::bit_cast<double>((xBits & 0x000FFFFFFFFFFFFF) + sqrtHalfHigh) - 1};
+        const auto hfsq{0.5 * f * f};
+        const auto s{f / (2 + f)};
+        const auto z{s * s};
+        const auto w{z * z};
+        const auto r{z * (6.666666666666735130e-01 +
+                          w * (2.857142874366239149e-01 +
+                               w * (1.818357216161805012e-01 +
+                                    w * 1.479819860511658591e-01))) +
+                     w * (3.999999999940941908e-01 +
+                          w * (2.222219843214978396e-01 +
+                               w * 1.531383769920937332e-01))};
+        return s * (hfsq + r) + k * 1.90821492927058770002e-10 - hfsq + f + k * 6.93147180369123816490e-01;
+    } else {
+        return std::log(x);
+    }
+}
+
+} // namespace Mustard::Math::internal
@@ -0,0 +1,75 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Mustard/Utility/FunctionAttribute.h++"
+
+#include "muc/utility"
+
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <limits>
+#include <numbers>
+#include <utility>
+
+namespace Mustard::Math::internal {
+
+/// @brief Full-precision {sin(2 pi u), cos(2 pi u)} on [0, 1], written without
+/// branches or table lookups so that loops over it are vectorized.
+/// @note u = q / 4 + r with integral q and |r| <= 1/8 (exactly), then sin and
+/// cos of 2 pi r are evaluated by the fdlibm k_sin.c and k_cos.c minimax
+/// polynomials and rotated by q quadrants.
+template<std::floating_point T>
+MUSTARD_ALWAYS_INLINE constexpr auto SinCos2PiOn01(T u) -> std::pair<T, T> {
+    assert(0 <= u and u <= 1);
+    muc::assume(0 <= u and u <= 1);
+    if constexpr (std::same_as<T, float> and std::numeric_limits<double>::is_iec559) {
+        const auto [sin, cos]{SinCos2PiOn01<double>(u)};
+        return {static_cast<float>(sin), static_cast<float>(cos)};
+    } else if constexpr (std::same_as<T, double> and std::numeric_limits<double>::is_iec559) {
+        // round to nearest without a call
+        const auto q{(4 * u + 0x1.8p52) - 0x1.8p52};
+        const auto x{2 * std::numbers::pi * (u - 0.25 * q)};
+        const auto z{x * x};
+        const auto sinX{x + x * z * (-1.66666666666666324348e-01 +
+                                     z * (8.33333333332248946124e-03 +
+                                          z * (-1.98412698298579493134e-04 +
+                                               z * (2.75573137070700676789e-06 +
+                                                    z * (-2.50507602534068634195e-08 +
+                                                         z * 1.58969099521155010221e-10)))))};
+        const auto hz{0.5 * z};
+        const auto w{1 - hz};
+        const auto cosX{w + (((1 - w) - hz) +
+                             z * z * (4.16666666666666019037e-02 +
+                                      z * (-1.38888888888741095749e-03 +
+                                           z * (2.48015872894767294178e-05 +
+                                                z * (-2.75573143513906633035e-07 +
+                                                     z * (2.08757232129817482790e-09 +
+                                                          z * -1.13596475577881948265e-11))))))};
+        const auto n{static_cast<int>(q)};
+        const auto sin{n & 1 ? cosX : sinX};
+        const auto cos{n & 1 ? sinX : cosX};
+        return {n & 2 ? -sin : sin, (n + 1) & 2 ? -cos : cos};
+    } else {
+        return {std::sin(2 * std::numbers::pi_v<T> * u), std::cos(2 * std::numbers::pi_v<T> * u)};
+    }
+}
+
+} // namespace Mustard::Math::internal
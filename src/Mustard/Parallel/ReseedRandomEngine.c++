@@ -16,10 +16,15 @@
 // You should have received a copy of the GNU General Public License along with
 // Mustard. If not, see <https://www.gnu.org/licenses/>.
 
+#include "Mustard/CLHEPX/Random/Philox.h++"
+#include "Mustard/CLHEPX/Random/Xoshiro.h++"
 #include "Mustard/IO/PrettyLog.h++"
 #include "Mustard/Math/Random/Distribution/Uniform.h++"
+#include "Mustard/Math/Random/Generator/SplitMix64.h++"
 #include "Mustard/Math/Random/Generator/Xoshiro256PlusPlus.h++"
 #include "Mustard/Parallel/ReseedRandomEngine.h++"
+#include "Mustard/ROOTX/Math/Philox.h++"
+#include "Mustard/ROOTX/Math/Xoshiro.h++"
 
 #include "CLHEP/Random/RandFlat.h"
 #include "CLHEP/Random/Random.h"
@@ -55,13 +60,14 @@ namespace {
 ///
 /// @tparam T Unsigned integral type for seeds (must be same width as seed components)
 /// @param xsr256Seed Seed value for Xoshiro256++ (bit-castable to uint64_t)
+/// @param n Number of seeds
 ///
-/// @return Set of unique seeds in range [1, max-1] with size = MPI world size
+/// @return Set of n unique seeds in range [1, max-1]
 ///
 /// @note Called exclusively by MPI rank 0 during seed generation
 /// @warning Must satisfy: worldComm.rank() == 0 (enforced by Expects)
 template<std::unsigned_integral T>
-auto MasterMakeUniqueSeedSeries(auto xsr256Seed) -> muc::flat_hash_set<T> {
+auto MasterMakeUniqueSeedSeries(auto xsr256Seed, int n) -> muc::flat_hash_set<T> {
     const auto worldComm{mplr::comm_world()};
     Expects(worldComm.rank() == 0);
 
@@ -70,14 +76,70 @@ auto MasterMakeUniqueSeedSeries(auto xsr256Seed) -> muc::flat_hash_set<T> {
     Math::Random::Uniform<T> uniform{1, std::numeric_limits<T>::max() - 1}; // not 0x00...00 and not 0xff...ff
 
     muc::flat_hash_set<T> uniqueSeeds;
-    const auto worldSize{worldComm.size()};
-    uniqueSeeds.reserve(worldSize);
+    uniqueSeeds.reserve(n);
     do {
         uniqueSeeds.emplace(uniform(xsr256));
-    } while (ssize(uniqueSeeds) < worldSize);
+    } while (ssize(uniqueSeeds) < n);
     return uniqueSeeds;
 }
 
+/// @brief Dispatches to the engine adapters of Xoshiro generators, which can be split
+/// into provably disjoint substreams
+template<typename... AEngines>
+struct XoshiroEngineList {
+    static auto Contains(auto* rng) -> bool {
+        return ((dynamic_cast<AEngines*>(rng) != nullptr) or ...);
+    }
+
+    /// @brief Seeds the engine and moves it to substream index
+    /// @pre Contains(rng)
+    static auto Split(auto* rng, auto seed, int index) -> void {
+        const auto split{((SplitAs<AEngines>(rng, seed, index)) or ...)};
+        Ensures(split);
+    }
+
+private:
+    template<typename AEngine>
+    static auto SplitAs(auto* rng, auto seed, int index) -> bool {
+        const auto xoshiro{dynamic_cast<AEngine*>(rng)};
+        if (xoshiro == nullptr) {
+            return false;
+        }
+        if constexpr (std::derived_from<AEngine, TRandom>) {
+            xoshiro->SetSeed(seed);
+        } else {
+            xoshiro->setSeed(seed);
+        }
+        xoshiro->Engine() = xoshiro->Engine().Split(index);
+        return true;
+    }
+};
+
+using CLHEPXoshiro = XoshiroEngineList<CLHEPX::Random::Xoshiro256StarStar,
+                                       CLHEPX::Random::Xoshiro256PlusPlus,
+                                       CLHEPX::Random::Xoshiro256Plus,
+                                       CLHEPX::Random::Xoshiro512StarStar,
+                                       CLHEPX::Random::Xoshiro512PlusPlus,
+                                       CLHEPX::Random::Xoshiro512Plus>;
+using ROOTXoshiro = XoshiroEngineList<ROOTX::Math::Xoshiro256StarStar,
+                                      ROOTX::Math::Xoshiro256PlusPlus,
+                                      ROOTX::Math::Xoshiro256Plus,
+                                      ROOTX::Math::Xoshiro512StarStar,
+                                      ROOTX::Math::Xoshiro512PlusPlus,
+                                      ROOTX::Math::Xoshiro512Plus>;
+
+/// @brief Hash of (seed, run, taskID) usable as a seed of any engine, i.e. not 0x00...00 and not 0xff...ff
+auto TaskSeed(std::uint64_t seed, std::uint64_t run, std::uint64_t taskID) -> std::uint64_t {
+    Math::Random::SplitMix64 splitMix64{seed};
+    splitMix64.Seed(splitMix64() ^ run);
+    splitMix64.Seed(splitMix64() ^ taskID);
+    std::uint64_t taskSeed;
+    do {
+        taskSeed = splitMix64();
+    } while (taskSeed == 0 or taskSeed == std::numeric_limits<std::uint64_t>::max());
+    return taskSeed;
+}
+
 } // namespace
 } // namespace internal
 
@@ -100,10 +162,10 @@ auto ReseedRandomEngine(CLHEP::HepRandomEngine* clhepRng, TRandom* tRandom) -> v
     static_assert(std::same_as<long, decltype(clhepRng->getSeed())>);
     static_assert(std::same_as<unsigned, decltype(tRandom->GetSeed())>);
 
-    using Seed = std::tuple<bool, long, bool, unsigned>; // (clhepNull, clhepSeed, rootNull, rootSeed)
+    using Seed = std::tuple<bool, bool, long, bool, bool, unsigned>; // (clhepNull, clhepSplit, clhepSeed, rootNull, rootSplit, rootSeed)
     Seed seedRecv;
     if (worldComm.rank() == 0) {
-        std::vector<Seed> seedSend(worldComm.size(), {true, 0, true, 0});
+        std::vector<Seed> seedSend(worldComm.size(), {true, false, 0, true, false, 0});
         if (clhepRng) {
             std::array<unsigned, sizeof(std::uint64_t) / sizeof(unsigned)> xsr256Seed;
             std::ranges::generate(xsr256Seed, [clhepRng] {
@@ -113,11 +175,15 @@ auto ReseedRandomEngine(CLHEP::HepRandomEngine* clhepRng, TRandom* tRandom) -> v
                 } while (seed == 0 or seed == std::numeric_limits<unsigned>::max());
                 return seed;
             });
-            const auto uniqueSeed{internal::MasterMakeUniqueSeedSeries<unsigned long>(xsr256Seed)};
-            Ensures(uniqueSeed.size() == seedSend.size());
-            for (gsl::index i{}; const auto& s : uniqueSeed) {
-                get<0>(seedSend[i]) = false;
-                get<1>(seedSend[i++]) = std::bit_cast<long>(s);
+            const auto split{internal::CLHEPXoshiro::Contains(clhepRng)};
+            const auto uniqueSeed{internal::MasterMakeUniqueSeedSeries<unsigned long>(xsr256Seed, split ? 1 : worldComm.size())};
+            for (auto s{uniqueSeed.begin()}; auto&& seed : seedSend) {
+                get<0>(seed) = false;
+                get<1>(seed) = split;
+                get<2>(seed) = std::bit_cast<long>(*s);
+                if (not split) {
+                    ++s;
+                }
             }
         }
         if (tRandom) {
@@ -126,11 +192,15 @@ auto ReseedRandomEngine(CLHEP::HepRandomEngine* clhepRng, TRandom* tRandom) -> v
             std::ranges::generate(xsr256Seed, [tRandom] {
                 return tRandom->Integer(-2) + 1;
             });
-            const auto uniqueSeed{internal::MasterMakeUniqueSeedSeries<unsigned>(xsr256Seed)};
-            Ensures(uniqueSeed.size() == seedSend.size());
-            for (gsl::index i{}; const auto& s : uniqueSeed) {
-                get<2>(seedSend[i]) = false;
-                get<3>(seedSend[i++]) = s;
+            const auto split{internal::ROOTXoshiro::Contains(tRandom)};
+            const auto uniqueSeed{internal::MasterMakeUniqueSeedSeries<unsigned>(xsr256Seed, split ? 1 : worldComm.size())};
+            for (auto s{uniqueSeed.begin()}; auto&& seed : seedSend) {
+                get<3>(seed) = false;
+                get<4>(seed) = split;
+                get<5>(seed) = *s;
+                if (not split) {
+                    ++s;
+                }
             }
         }
         worldComm.scatter(0, seedSend.data(), seedRecv);
@@ -141,16 +211,54 @@ auto ReseedRandomEngine(CLHEP::HepRandomEngine* clhepRng, TRandom* tRandom) -> v
     if (get<0>(seedRecv) != (clhepRng == nullptr)) {
         Throw<std::invalid_argument>("CLHEP random engine null/!null inconsistent");
     }
-    if (get<2>(seedRecv) != (tRandom == nullptr)) {
+    if (get<3>(seedRecv) != (tRandom == nullptr)) {
         Throw<std::invalid_argument>("ROOT random engine null/!null inconsistent");
     }
     if (clhepRng) {
-        Ensures(get<1>(seedRecv) != 0 and get<1>(seedRecv) != -1); // not 0x00...00 and not 0xff...ff
-        clhepRng->setSeed(get<1>(seedRecv), 3);
+        if (get<1>(seedRecv) != internal::CLHEPXoshiro::Contains(clhepRng)) {
+            Throw<std::invalid_argument>("CLHEP random engine Xoshiro/!Xoshiro inconsistent");
+        }
+        Ensures(get<2>(seedRecv) != 0 and get<2>(seedRecv) != -1); // not 0x00...00 and not 0xff...ff
+        if (get<1>(seedRecv)) {
+            internal::CLHEPXoshiro::Split(clhepRng, get<2>(seedRecv), worldComm.rank());
+        } else {
+            clhepRng->setSeed(get<2>(seedRecv), 3);
+        }
     }
     if (tRandom) {
-        Ensures(get<3>(seedRecv) != 0 and get<3>(seedRecv) != static_cast<unsigned>(-1)); // not 0x00...00 and not 0xff...ff
-        tRandom->SetSeed(get<3>(seedRecv));
+        if (get<4>(seedRecv) != internal::ROOTXoshiro::Contains(tRandom)) {
+            Throw<std::invalid_argument>("ROOT random engine Xoshiro/!Xoshiro inconsistent");
+        }
+        Ensures(get<5>(seedRecv) != 0 and get<5>(seedRecv) != static_cast<unsigned>(-1)); // not 0x00...00 and not 0xff...ff
+        if (get<4>(seedRecv)) {
+            internal::ROOTXoshiro::Split(tRandom, get<5>(seedRecv), worldComm.rank());
+        } else {
+            tRandom->SetSeed(get<5>(seedRecv));
+        }
+    }
+}
+
+auto ReseedRandomEngineForTask(std::uint64_t seed, std::uint64_t run, std::uint64_t taskID,
+                               CLHEP::HepRandomEngine* clhepRng, TRandom* tRandom) -> void {
+    if (clhepRng == nullptr) {
+        clhepRng = CLHEP::HepRandom::getTheEngine();
+    }
+    if (tRandom == nullptr) {
+        tRandom = gRandom;
+    }
+
+    if (const auto philox{dynamic_cast<CLHEPX::Random::Philox4x64*>(clhepRng)}) {
+        philox->setSeed(std::bit_cast<long>(seed));
+        philox->Engine().Stream(run, taskID);
+    } else if (clhepRng) {
+        clhepRng->setSeed(std::bit_cast<long>(internal::TaskSeed(seed, run, taskID)), 3);
+    }
+    // ~seed: ROOT and CLHEP streams differ
+    if (const auto philox{dynamic_cast<ROOTX::Math::Philox4x64*>(tRandom)}) {
+        philox->SetSeed(~seed);
+        philox->Engine().Stream(run, taskID);
+    } else if (tRandom) {
+        tRandom->SetSeed(internal::TaskSeed(~seed, run, taskID));
     }
 }
 
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 namespace CLHEP {
 class HepRandomEngine;
 } // namespace CLHEP
@@ -39,11 +41,14 @@ namespace Mustard::Parallel {
 ///   - Master RNG (Xoshiro256++) seeded from:
 ///       * CLHEP: Uniform integers in [1, max_unsigned-1]
 ///       * ROOT: TRandom::Integer() adjusted to avoid 0/max
+///   - Xoshiro engines (CLHEPX::Random::Xoshiro*, ROOTX::Math::Xoshiro*) get
+///     a common seed and are then split by rank (see XoshiroBase::Split), so
+///     that streams of different ranks provably do not overlap
 ///
 /// @param clhepRng CLHEP engine to reseed (uses default if null)
 /// @param tRandom ROOT engine to reseed (uses gRandom if null)
 ///
-/// @throws std::invalid_argument If engine null-state mismatches between rank 0 and current rank
+/// @throws std::invalid_argument If engine null-state or Xoshiro-ness mismatches between rank 0 and current rank
 ///
 /// @note Collective MPI operation (must be called by all ranks)
 /// @warning Seeds avoid 0 and max values to prevent engine-specific edge cases
@@ -51,4 +56,30 @@ namespace Mustard::Parallel {
 /// @remark Intra-rank consistency checks prevent null/non-null engine mismatches
 auto ReseedRandomEngine(CLHEP::HepRandomEngine* clhepRng = {}, TRandom* tRandom = {}) -> void;
 
+/// @brief Reseeds random engines to the stream of one task
+///
+/// The stream depends only on (seed, run, taskID), so results are identical
+/// regardless of the number of processes and the scheduler. Intended as an
+/// Executor pre-task hook.
+///
+/// Behavior:
+///   - CLHEPX::Random::Philox4x64 and ROOTX::Math::Philox4x64 jump to stream
+///     (run, taskID) under key seed, in O(1)
+///   - Other engines are reseeded with a hash of (seed, run, taskID), at the
+///     cost of their seeding procedure
+///   - Uses CLHEP default engine if clhepRng=nullptr
+///   - Uses ROOT gRandom if tRandom=nullptr
+///
+/// @param seed Global seed, same on all ranks
+/// @param run Run index, e.g. Geant4 run ID
+/// @param taskID Task index, e.g. Geant4 event ID
+/// @param clhepRng CLHEP engine to reseed (uses default if null)
+/// @param tRandom ROOT engine to reseed (uses gRandom if null)
+///
+/// @note Not collective. Engines must not be shared by concurrently running tasks,
+/// in particular the default ones are process-wide: with a multithreaded executor,
+/// pass the engines of the calling thread.
+auto ReseedRandomEngineForTask(std::uint64_t seed, std::uint64_t run, std::uint64_t taskID,
+                               CLHEP::HepRandomEngine* clhepRng = {}, TRandom* tRandom = {}) -> void;
+
 } // namespace Mustard::Parallel
@@ -60,7 +60,10 @@ public:
 
     /// @brief Seed the underlying random engine
     /// @param seed New seed value (converted to PRBG's SeedType)
-    virtual auto SetSeed(ULong_t seed) -> void override { fPRBG.Seed(seed); }
+    virtual auto SetSeed(ULong_t seed) -> void override {
+        fPRBG.Seed(seed);
+        fGaussian.Reset();
+    }
     /// @brief Generate uniform double in (0,1)
     virtual auto Rndm() -> Double_t override { return Mustard::Math::Random::Uniform<Double_t>{}(fPRBG); }
     /// @brief Fill array with uniform float values in (0,1)
@@ -72,6 +75,14 @@ public:
     /// @param array Pre-allocated output buffer
     virtual auto RndmArray(Int_t n, Double_t* array) -> void override;
 
+    /// @brief Underlying PRBG
+    auto Engine() const -> const PRBG& { return fPRBG; }
+    /// @brief Access the underlying PRBG, e.g. to select a stream of a counter-based generator.
+    /// Call ResetGaussian() after changing its state.
+    auto Engine() -> PRBG& { return fPRBG; }
+    /// @brief Discard the Gaussian number saved from the previous pair
+    auto ResetGaussian() -> void { fGaussian.Reset(); }
+
 private:
     /// @brief [Disabled] TRandom requires GetSeed() but PRBGs are stateless
     /// @return Always 0
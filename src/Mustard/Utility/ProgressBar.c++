@@ -103,6 +103,13 @@ auto ProgressBar::Tick(std::chrono::nanoseconds printInterval) -> void {
     fImpl->printStopWatch.reset();
 }
 
+auto ProgressBar::Update(std::size_t progress) -> void {
+    fImpl->progress = progress;
+    fImpl->asyncPrint.get();
+    fImpl->asyncPrint = std::async(std::mem_fn(&ProgressBar::Print), this, fImpl->progress);
+    fImpl->printStopWatch.reset();
+}
+
 auto ProgressBar::Complete() -> void {
     fImpl->progress = fImpl->total;
     Stop();
@@ -36,6 +36,8 @@ public:
 
     auto Start(std::size_t nTotal) -> void;
     auto Tick(std::chrono::nanoseconds printInterval = std::chrono::milliseconds{33}) -> void;
+    /// @brief Set the progress and print immediately, for callers that control the print rate.
+    auto Update(std::size_t progress) -> void;
     auto Complete() -> void;
     auto Stop() -> void;
 
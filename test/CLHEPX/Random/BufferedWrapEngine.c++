@@ -0,0 +1,126 @@
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/CLHEPX/Random/BufferedWrap.h++"
+#include "Mustard/CLHEPX/Random/Xoshiro.h++"
+
+#include "CLHEP/Random/RandomEngine.h"
+
+#include "muc/chrono"
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+using namespace Mustard;
+
+// Same sequence after interleaved flat() and flatArray() calls, and after
+// put/get in the middle of a block, also for the conversion operators.
+auto Reproducible(const char* name, CLHEP::HepRandomEngine& engine, CLHEP::HepRandomEngine& reference) -> bool {
+    auto passed{true};
+    std::vector<double> array(1234);
+    for (int i{}; i < 100; ++i) {
+        passed &= engine.flat() == reference.flat();
+    }
+    engine.flatArray(array.size(), array.data());
+    for (auto&& x : array) {
+        passed &= x == reference.flat();
+    }
+    for (int i{}; i < 100; ++i) {
+        passed &= static_cast<float>(engine) == static_cast<float>(reference.flat());
+        passed &= static_cast<unsigned int>(engine) == static_cast<unsigned int>(reference.flat() * 0x1p32);
+    }
+    std::stringstream stream;
+    engine.put(stream);
+    std::vector<double> expected(2000);
+    std::vector<float> expectedFloat(500);
+    std::vector<unsigned int> expectedUInt(500);
+    for (auto&& x : expected) {
+        x = engine.flat();
+    }
+    for (std::size_t i{}; i < expectedFloat.size(); ++i) {
+        expectedFloat[i] = static_cast<float>(engine);
+        expectedUInt[i] = static_cast<unsigned int>(engine);
+    }
+    engine.setSeed(0x654321, 0);
+    engine.get(stream);
+    for (auto&& x : expected) {
+        passed &= engine.flat() == x;
+    }
+    for (std::size_t i{}; i < expectedFloat.size(); ++i) {
+        passed &= static_cast<float>(engine) == expectedFloat[i];
+        passed &= static_cast<unsigned int>(engine) == expectedUInt[i];
+    }
+    std::cout << name << (passed ? "  passed" : "  FAILED") << std::endl;
+    return passed;
+}
+
+// not inlined, so flat() is a virtual call as in Geant4
+[[gnu::noinline]] auto Time(const char* name, CLHEP::HepRandomEngine& engine) -> void {
+    auto sum{0.};
+    for (int i = 0; i < 1'000'000; ++i) {
+        sum += engine.flat();
+    }
+    muc::chrono::stopwatch stopwatch;
+    for (int i = 0; i < 100'000'000; ++i) {
+        sum += engine.flat();
+    }
+    muc::chrono::milliseconds<double> time{stopwatch.read()};
+    std::cout << name << time << " (sum: " << sum << ')' << std::endl;
+}
+
+[[gnu::noinline]] auto TimeArray(const char* name, CLHEP::HepRandomEngine& engine) -> void {
+    std::vector<double> array(100);
+    auto sum{0.};
+    muc::chrono::stopwatch stopwatch;
+    for (int i = 0; i < 1'000'000; ++i) {
+        engine.flatArray(array.size(), array.data());
+        sum += array[i % array.size()];
+    }
+    muc::chrono::milliseconds<double> time{stopwatch.read()};
+    std::cout << name << time << " (sum: " << sum << ')' << std::endl;
+}
+
+int main() {
+    std::cout << "Reproducibility:" << std::endl;
+    auto passed{true};
+    {
+        CLHEPX::Random::BufferedWrap<Math::Random::Xoshiro256PlusPlus> buffered{0x123456};
+        CLHEPX::Random::Wrap<Math::Random::Xoshiro256PlusPlus> unbuffered{0x123456};
+        passed &= Reproducible("BufferedWrap<Xoshiro256PlusPlus> (vs. Wrap)", buffered, unbuffered);
+    }
+    {
+        CLHEPX::Random::Xoshiro256PlusPlusX4 buffered{0x123456};
+        CLHEPX::Random::BufferedWrap<Math::Random::Xoshiro256PlusPlusX4, 64> reference{0x123456};
+        passed &= Reproducible("             Xoshiro256PlusPlusX4 (vs. 64)", buffered, reference);
+    }
+
+    std::cout << "Generate 100 million numbers by virtual flat():" << std::endl;
+    CLHEPX::Random::Xoshiro256PlusPlus xoshiro256PP;
+    CLHEPX::Random::Wrap<Math::Random::Xoshiro256PlusPlusX4> unbufferedXoshiro256PPX4;
+    CLHEPX::Random::Xoshiro256PlusPlusX4 xoshiro256PPX4;
+    Time("          Wrap<Math::...::Xoshiro256PlusPlus> : ", xoshiro256PP);
+    Time("        Wrap<Math::...::Xoshiro256PlusPlusX4> : ", unbufferedXoshiro256PPX4);
+    Time("BufferedWrap<Math::...::Xoshiro256PlusPlusX4> : ", xoshiro256PPX4);
+    std::cout << "Generate 100 million numbers by flatArray() of 100:" << std::endl;
+    TimeArray("          Wrap<Math::...::Xoshiro256PlusPlus> : ", xoshiro256PP);
+    TimeArray("        Wrap<Math::...::Xoshiro256PlusPlusX4> : ", unbufferedXoshiro256PPX4);
+    TimeArray("BufferedWrap<Math::...::Xoshiro256PlusPlusX4> : ", xoshiro256PPX4);
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,127 @@
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Data/RDFEventSplit.h++"
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/IO/Print.h++"
+
+#include "ROOT/RDataFrame.hxx"
+#include "TFile.h"
+#include "TTree.h"
+
+#include "mplr/mplr.hpp"
+
+#include "gsl/gsl"
+
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Mustard;
+
+auto MakeEventID(int nEntry, unsigned seed) -> std::vector<int> {
+    std::mt19937 random{seed};
+    std::vector<int> eventID;
+    eventID.reserve(nEntry);
+    for (int id{}; ssize(eventID) < nEntry; ++id) {
+        // 1 to 4 entries per event, so that events cross slice boundaries
+        for (auto i{random() % 4}; i < 4 and ssize(eventID) < nEntry; ++i) {
+            eventID.emplace_back(id);
+        }
+    }
+    return eventID;
+}
+
+auto MakeEventSplit(const std::vector<int>& eventID) -> std::vector<gsl::index> {
+    std::vector<gsl::index> es;
+    for (gsl::index i{}; i < ssize(eventID); ++i) {
+        if (i == 0 or eventID[i] != eventID[i - 1]) {
+            es.emplace_back(i);
+        }
+    }
+    es.emplace_back(ssize(eventID));
+    return es;
+}
+
+auto main(int argc, char* argv[]) -> int {
+    Mustard::Env::MPIEnv env{argc, argv, {}};
+
+    const auto n{argc > 1 ? gsl::narrow<int>(std::stoul(argv[1])) : 10000};
+    const auto worldComm{mplr::comm_world()};
+    const std::filesystem::path directory{"TestRDFEventSplit"};
+    const auto fileName{(directory / "data.root").generic_string()};
+
+    // trees "t" and "u" have the same number of entries but different events
+    const auto eventIDT{MakeEventID(n, 1)};
+    const auto eventIDU{MakeEventID(n, 2)};
+    if (worldComm.rank() == 0) {
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+        TFile file{fileName.c_str(), "RECREATE"};
+        for (auto&& [name, eventID] : {std::pair{"t", &eventIDT}, std::pair{"u", &eventIDU}}) {
+            int id;
+            TTree tree{name, name};
+            tree.Branch("id", &id);
+            for (auto i : *eventID) {
+                id = i;
+                tree.Fill();
+            }
+            tree.Write();
+        }
+    }
+    worldComm.barrier();
+
+    // slices scanned by each process are stitched to the serial result
+    ROOT::RDataFrame t{"t", fileName};
+    if (Data::RDFEventSplit<int>(t, "id") != MakeEventSplit(eventIDT)) {
+        PrintError("Event split of stitched slices differs from the serial one");
+    }
+
+    // the first call writes the cache, the second one reads it and only counts entries
+    const Data::RDFEventSplitCache cacheT{directory / "cache", {fileName}, "t"};
+    if (Data::RDFEventSplit<int>(t, "id", cacheT) != MakeEventSplit(eventIDT)) {
+        PrintError("Event split differs when writing the cache");
+    }
+    const auto nRun{t.GetNRuns()};
+    if (Data::RDFEventSplit<int>(t, "id", cacheT) != MakeEventSplit(eventIDT)) {
+        PrintError("Event split differs when reading the cache");
+    }
+    if (t.GetNRuns() != nRun + 1) {
+        PrintError("Cached event split not used");
+    }
+
+    // same files and number of entries, another tree
+    ROOT::RDataFrame u{"u", fileName};
+    if (Data::RDFEventSplit<int>(u, "id", {directory / "cache", {fileName}, "u"}) != MakeEventSplit(eventIDU)) {
+        PrintError("Cached event split of another tree used");
+    }
+
+    // same files and tree, fewer entries
+    const std::vector half(eventIDT.cbegin(), eventIDT.cbegin() + n / 2);
+    if (Data::RDFEventSplit<int>(t.Range(n / 2), "id", cacheT) != MakeEventSplit(half)) {
+        PrintError("Cached event split with another number of entries used");
+    }
+
+    worldComm.barrier();
+    if (worldComm.rank() == 0) {
+        std::filesystem::remove_all(directory);
+    }
+    MasterPrintLn("TestRDFEventSplit done");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,143 @@
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "Mustard/Data/Processor.h++"
+#include "Mustard/Data/TakeFrom.h++"
+#include "Mustard/Data/Tuple.h++"
+#include "Mustard/Data/TupleBatch.h++"
+#include "Mustard/Data/TupleModel.h++"
+#include "Mustard/Data/Value.h++"
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/IO/Print.h++"
+
+#include "ROOT/RDataFrame.hxx"
+#include "TFile.h"
+#include "TTree.h"
+
+#include "mplr/mplr.hpp"
+
+#include "gsl/gsl"
+
+#include "fmt/core.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <ranges>
+#include <string>
+#include <vector>
+
+using namespace Mustard;
+
+using Hit = Data::TupleModel<Data::Value<int, "id">,
+                             Data::Value<float, "e">,
+                             Data::Value<std::vector<double>, "w">>;
+
+auto main(int argc, char* argv[]) -> int {
+    Mustard::Env::MPIEnv env{argc, argv, {}};
+
+    const auto n{argc > 1 ? gsl::narrow<int>(std::stoul(argv[1])) : 10000};
+    const auto worldComm{mplr::comm_world()};
+    const std::filesystem::path directory{"TestTupleBatch"};
+    const auto fileName{(directory / "data.root").generic_string()};
+
+    // scalar columns and a jagged column with 0 to 3 values per entry
+    if (worldComm.rank() == 0) {
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+        TFile file{fileName.c_str(), "RECREATE"};
+        int id;
+        float e;
+        std::vector<double> w;
+        TTree tree{"t", "t"};
+        tree.Branch("id", &id);
+        tree.Branch("e", &e);
+        tree.Branch("w", &w);
+        for (id = 0; id < n; ++id) {
+            e = 0.5f * id;
+            w.clear();
+            for (auto k{0}; k < id % 4; ++k) {
+                w.emplace_back(id + 0.25 * k);
+            }
+            tree.Fill();
+        }
+        tree.Write();
+    }
+    worldComm.barrier();
+
+    ROOT::RDataFrame rdf{"t", fileName};
+
+    // columns and rows of a batch against the per-row Tuple path
+    const auto tuple{Data::Take<Hit>::From(rdf)};
+    const auto batch{Data::Take<Hit>::BatchFrom(rdf)};
+    if (batch.size() != tuple.size() or ssize(tuple) != n) {
+        PrintError(fmt::format("Batch size ({}) or tuple size ({}) != {}", batch.size(), tuple.size(), n));
+    }
+    const auto& id{batch.Column<"id">()};
+    const auto& e{batch.Column<"e">()};
+    const auto& w{batch.Column<"w">()};
+    if (w.Offset().front() != 0 or w.Offset().back() != ssize(w.Value())) {
+        PrintError("Offsets of the jagged column do not span its values");
+    }
+    for (gsl::index i{}; i < ssize(tuple); ++i) {
+        const auto& t{*tuple[i]};
+        if (*id[i] != *t.Get<"id">() or *e[i] != *t.Get<"e">() or
+            not std::ranges::equal(w[i], *t.Get<"w">())) {
+            PrintError(fmt::format("Column view differs from tuple at entry {}", i));
+        }
+        const auto row{batch[i]};
+        if (*row.Get<"id">() != *t.Get<"id">() or *row.Get<"e">() != *t.Get<"e">() or
+            not std::ranges::equal(row.Get<"w">(), *t.Get<"w">()) or
+            *row.As<Data::Tuple<Hit>>().Get<"w">() != *t.Get<"w">()) {
+            PrintError(fmt::format("Row differs from tuple at entry {}", i));
+        }
+    }
+    gsl::index nRow{};
+    for (auto&& row : batch) {
+        if (*row.Get<"id">() != nRow++) {
+            PrintError(fmt::format("Row {} out of order", nRow - 1));
+        }
+    }
+    if (nRow != n) {
+        PrintError(fmt::format("Iterated {} rows of {}", nRow, n));
+    }
+
+    // every entry is visited exactly once by all processes together
+    std::vector<int> nVisit(n);
+    Data::Processor<> processor;
+    processor.ProcessBatch<Hit>(rdf, [&](bool byPass, Data::TupleBatch<Hit> batch) {
+        if (byPass) {
+            return;
+        }
+        for (auto&& row : batch) {
+            ++nVisit[*row.Get<"id">()];
+        }
+    });
+    worldComm.allreduce(mplr::plus<int>{}, nVisit.data(), mplr::contiguous_layout<int>{nVisit.size()});
+    if (const auto i{std::ranges::find_if(nVisit, [](auto k) { return k != 1; })};
+        i != nVisit.cend()) {
+        PrintError(fmt::format("Entry {} visited {} times by ProcessBatch", i - nVisit.cbegin(), *i));
+    }
+
+    worldComm.barrier();
+    if (worldComm.rank() == 0) {
+        std::filesystem::remove_all(directory);
+    }
+    MasterPrintLn("TestTupleBatch done");
+
+    return EXIT_SUCCESS;
+}
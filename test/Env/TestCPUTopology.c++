@@ -0,0 +1,87 @@
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "Mustard/Env/internal/CPUTopology.h++"
+#include "Mustard/IO/PrettyLog.h++"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace Mustard;
+using Mustard::Env::internal::CPUTopology;
+
+auto main() -> int {
+    // sysfs CPU lists
+    const std::vector<std::pair<std::string_view, std::vector<int>>> parseCase{
+        {"",            {}                     },
+        {"0",           {0}                    },
+        {"0-3",         {0, 1, 2, 3}           },
+        {"0-3,8,10-11", {0, 1, 2, 3, 8, 10, 11}},
+        {"0-1,4-5\n",   {0, 1, 4, 5}           },
+        {"x,2",         {2}                    }
+    };
+    for (auto&& [list, truth] : parseCase) {
+        if (CPUTopology::ParseCPUList(list) != truth) {
+            PrintError(fmt::format("ParseCPUList(\"{}\") is wrong", list));
+        }
+    }
+    for (auto&& list : {"0", "0-3", "0-3,8,10-11", "1,3,5", "0-1,4-5"}) {
+        if (CPUTopology::FormatCPUList(CPUTopology::ParseCPUList(list)) != list) {
+            PrintError(fmt::format("FormatCPUList(ParseCPUList(\"{}\")) != \"{}\"", list, list));
+        }
+    }
+
+    // topology of this machine: every core in exactly one NUMA domain, all CPUs allowed
+    const CPUTopology topology;
+    if (not topology.Available()) {
+        return EXIT_SUCCESS;
+    }
+    const auto affinity{CPUTopology::AffinityCPU()};
+    std::vector<int> coreCPU;
+    for (auto&& core : topology.CoreList()) {
+        if (core.empty()) {
+            PrintError("Empty core");
+        }
+        for (auto&& cpu : core) {
+            coreCPU.emplace_back(cpu);
+            if (not std::ranges::binary_search(affinity, cpu)) {
+                PrintError(fmt::format("CPU {} is not in the affinity mask", cpu));
+            }
+            const auto domain{topology.NUMADomainOf(cpu)};
+            if (std::ranges::none_of(topology.NUMADomainList(), [&](auto&& d) {
+                    return d.id == domain and std::ranges::find(d.cpu, cpu) != d.cpu.cend();
+                })) {
+                PrintError(fmt::format("CPU {} is not in its NUMA domain {}", cpu, domain));
+            }
+        }
+    }
+    std::ranges::sort(coreCPU);
+    if (std::ranges::adjacent_find(coreCPU) != coreCPU.cend()) {
+        PrintError("A CPU belongs to several cores");
+    }
+    if (coreCPU != affinity) {
+        PrintError("Cores do not cover the affinity mask");
+    }
+
+    return EXIT_SUCCESS;
+}
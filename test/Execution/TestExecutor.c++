@@ -14,61 +14,28 @@
 // You should have received a copy of the GNU General Public License along with
 // Mustard. If not, see <https://www.gnu.org/licenses/>.
 
+#include "CheckIndexList.h++"
+
 #include "Mustard/Env/MPIEnv.h++"
 #include "Mustard/Execution/Executor.h++"
 #include "Mustard/IO/Print.h++"
 
 #include "mplr/mplr.hpp"
 
-#include "muc/algorithm"
 #include "muc/numeric"
 
 #include "gsl/gsl"
 
 #include <algorithm>
+#include <memory>
+#include <stdexcept>
 #include <string>
 #include <thread>
+#include <utility>
 
 using namespace Mustard;
 using namespace std::chrono_literals;
 
-auto CheckIndexList(int truthN, const std::vector<int>& localIndexList) -> void {
-    const auto worldComm{mplr::comm_world()};
-    if (worldComm.rank() == 0) {
-        std::vector<int> size(worldComm.size());
-        worldComm.gather<int>(0, localIndexList.size(), size.data());
-        const auto n{muc::ranges::reduce(size, 0ll)};
-
-        mplr::displacements disp(worldComm.size());
-        for (auto i{1}; i < worldComm.size(); ++i) {
-            disp[i] = disp[i - 1] + size[i - 1];
-        }
-        mplr::contiguous_layouts<int> layout(worldComm.size());
-        std::ranges::transform(size, layout.begin(), [](auto n) { return mplr::contiguous_layout<int>(n); });
-        std::vector<int> indexList(n);
-        worldComm.gatherv(0, localIndexList.data(), mplr::contiguous_layout<int>{localIndexList.size()},
-                          indexList.data(), layout, disp);
-
-        muc::timsort(indexList);
-        std::vector<int> diffList(indexList.size());
-        muc::ranges::adjacent_difference(indexList, diffList.begin());
-        const auto sum{muc::ranges::reduce(indexList, 0ll)};
-
-        if (n != truthN) {
-            PrintError("n != truthN");
-        }
-        if (not std::ranges::all_of(diffList.cbegin() + 1, diffList.cend(), [](auto d) { return d == 1; })) {
-            PrintError("not std::ranges::all_of(diffList.cbegin() + 1, diffList.cend(), [](auto d) { return d == 1; })");
-        }
-        if (sum != n * (n - 1) / 2) {
-            PrintError("sum != n * (n - 1) / 2");
-        }
-    } else {
-        worldComm.gather<int>(0, localIndexList.size());
-        worldComm.gatherv(0, localIndexList.data(), mplr::contiguous_layout<int>{localIndexList.size()});
-    }
-}
-
 auto main(int argc, char* argv[]) -> int {
     Mustard::Env::MPIEnv env{argc, argv, {}};
 
@@ -108,6 +75,7 @@ auto main(int argc, char* argv[]) -> int {
     std::this_thread::sleep_for(1s);
 
     executor.PrintProgressInterval(100ms);
+    executor.Profile(true);
     localIndexList.clear();
     executor(n, [&](auto i) {
         localIndexList.emplace_back(i);
@@ -115,6 +83,96 @@ auto main(int argc, char* argv[]) -> int {
     });
     executor.PrintExecutionSummary();
     CheckIndexList(n, localIndexList);
+    const auto& taskDuration{executor.ExecutionInfo().taskDuration};
+    if (taskDuration.p50 < 400ms or taskDuration.p50 > taskDuration.max) {
+        PrintError("taskDuration.p50 < 400ms or taskDuration.p50 > taskDuration.max");
+    }
+    executor.WriteExecutionInfo("TestExecutor.json");
+    executor.WriteExecutionInfo("TestExecutor.csv");
+    MasterPrintLn("");
+
+    for (auto&& policy : {BatchPolicy::Guided, BatchPolicy::Factoring}) {
+        std::this_thread::sleep_for(1s);
+
+        executor.BatchPolicy(policy);
+        localIndexList.clear();
+        executor(bigN, [&](auto i) { localIndexList.emplace_back(i); });
+        executor.PrintExecutionSummary();
+        CheckIndexList(bigN, localIndexList);
+        const auto& batchSizeTrace{executor.ExecutionInfo().batchSizeTrace};
+        if (not batchSizeTrace.empty() and muc::ranges::reduce(batchSizeTrace, 0ll) != ssize(localIndexList)) {
+            PrintError("not batchSizeTrace.empty() and muc::ranges::reduce(batchSizeTrace, 0ll) != ssize(localIndexList)");
+        }
+        MasterPrintLn("{} batches on rank 0", batchSizeTrace.size());
+    }
+
+    for (auto nodeAware : {false, true}) {
+        std::this_thread::sleep_for(1s);
+
+        const auto Cost{[](int i) { return 1 + i % 7; }};
+        auto scheduler{std::make_unique<CostWeightedScheduler<int>>([Cost](int i) -> double { return Cost(i); })};
+        scheduler->NodeAware(nodeAware);
+        executor.SwitchScheduler(std::move(scheduler));
+        localIndexList.clear();
+        executor(n, [&](auto i) {
+            localIndexList.emplace_back(i);
+            std::this_thread::sleep_for(Cost(i) * 10ms);
+        });
+        executor.PrintExecutionSummary();
+        CheckIndexList(n, localIndexList);
+        MasterPrintLn("");
+    }
+
+    for (auto&& scheduler : {"ws", "hshm"}) {
+        std::this_thread::sleep_for(1s);
+
+        executor.SwitchScheduler(scheduler);
+        localIndexList.clear();
+        executor(bigN, [&](auto i) { localIndexList.emplace_back(i); });
+        executor.PrintExecutionSummary();
+        CheckIndexList(bigN, localIndexList);
+        localIndexList.clear();
+        executor(n, [&](auto i) {
+            localIndexList.emplace_back(i);
+            std::this_thread::sleep_for((1 + i % 7) * 10ms);
+        });
+        executor.PrintExecutionSummary();
+        CheckIndexList(n, localIndexList);
+        MasterPrintLn("");
+    }
+
+    std::this_thread::sleep_for(1s);
+
+    // two loops in flight
+    Executor<int> pilot{"Pilot", "Sample"};
+    std::vector<int> pilotIndexList;
+    executor.SwitchScheduler(DefaultSchedulerCode());
+    localIndexList.clear();
+    auto execution{executor.Launch(n, [&](auto i) {
+        localIndexList.emplace_back(i);
+        std::this_thread::sleep_for(100ms);
+    })};
+    auto pilotExecution{pilot.Launch(bigN, [&](auto i) { pilotIndexList.emplace_back(i); })};
+    try {
+        executor.Launch(n, [](auto) {});
+        PrintError("Launch during executing did not throw");
+    } catch (const std::logic_error&) {}
+    try {
+        executor(n, [](auto) {});
+        PrintError("Synchronous execution during executing did not throw");
+    } catch (const std::logic_error&) {}
+    // the pending loop does not refer to the executor object
+    auto movedExecutor{std::move(executor)};
+    while (not execution.Ready() or not pilotExecution.Ready()) {
+        std::this_thread::sleep_for(10ms);
+    }
+    if (execution.Get() != ssize(localIndexList) or pilotExecution.Get() != ssize(pilotIndexList)) {
+        PrintError("execution.Get() != ssize(localIndexList) or pilotExecution.Get() != ssize(pilotIndexList)");
+    }
+    movedExecutor.PrintExecutionSummary();
+    pilot.PrintExecutionSummary();
+    CheckIndexList(n, localIndexList);
+    CheckIndexList(bigN, pilotIndexList);
 
     return EXIT_SUCCESS;
 }
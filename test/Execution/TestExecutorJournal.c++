@@ -0,0 +1,87 @@
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Env/BasicEnv.h++"
+#include "Mustard/Execution/Executor.h++"
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/IO/Print.h++"
+
+#include "gsl/gsl"
+
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Mustard;
+
+auto main(int argc, char* argv[]) -> int {
+    Mustard::Env::BasicEnv env{argc, argv, {}};
+
+    const auto n{argc > 1 ? gsl::narrow<int>(std::stoul(argv[1])) : 1000};
+    const auto preempted{n / 3};
+    const std::filesystem::path journal{"TestExecutorJournal/journal.txt"};
+    std::filesystem::remove_all(journal.parent_path());
+
+    // record: interrupted at task `preempted`
+    try {
+        Executor<int> executor{"seq"};
+        executor.PrintProgress(false);
+        executor.Journal(journal);
+        executor.JournalInterval({});
+        executor(n, [&](auto i) {
+            if (i == preempted) {
+                throw std::runtime_error{"preempted"};
+            }
+        });
+        PrintError("Execution not interrupted");
+    } catch (const std::runtime_error&) {}
+    if (not std::filesystem::exists(journal)) {
+        PrintError("Journal not written");
+    }
+
+    // resume: only tasks not recorded are executed, and the journal is removed on finish
+    std::vector<int> indexList;
+    {
+        Executor<int> executor{"seq"};
+        executor.PrintProgress(false);
+        executor.Journal(journal);
+        executor(n, [&](auto i) { indexList.emplace_back(i); });
+    }
+    if (ssize(indexList) != n - preempted or indexList.front() != preempted or indexList.back() != n - 1) {
+        PrintError("Resumed execution does not continue from the interruption");
+    }
+    if (std::filesystem::exists(journal)) {
+        PrintError("Journal not removed after finish");
+    }
+
+    // rerun with the same journal path: all tasks are executed
+    indexList.clear();
+    {
+        Executor<int> executor{"seq"};
+        executor.PrintProgress(false);
+        executor.Journal(journal);
+        executor(n, [&](auto i) { indexList.emplace_back(i); });
+    }
+    if (ssize(indexList) != n) {
+        PrintError("Rerun skips tasks of a finished execution");
+    }
+
+    std::filesystem::remove_all(journal.parent_path());
+    MasterPrintLn("TestExecutorJournal done");
+
+    return EXIT_SUCCESS;
+}
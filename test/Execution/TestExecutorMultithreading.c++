@@ -0,0 +1,89 @@
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "CheckIndexList.h++"
+
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/Execution/Executor.h++"
+#include "Mustard/IO/Print.h++"
+
+#include "mplr/mplr.hpp"
+
+#include "gsl/gsl"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Mustard;
+using namespace std::chrono_literals;
+
+auto main(int argc, char* argv[]) -> int {
+    Mustard::Env::MPIEnv env{argc, argv, {}};
+
+    Executor<int> executor{argc > 2 ? argv[2] : "mt"};
+    MasterPrintLn("Running with {} thread(s) per process", executor.NThread());
+
+    const auto n{gsl::narrow<int>(std::stoul(argv[1]))};
+
+    std::mutex mutex;
+    std::vector<int> localIndexList;
+    const auto AppendIndex{[&](auto i) {
+        const std::scoped_lock lock{mutex};
+        localIndexList.emplace_back(i);
+    }};
+
+    executor.PrintProgress(false);
+    executor(n, AppendIndex);
+    executor.PrintExecutionSummary();
+    CheckIndexList(n, localIndexList);
+    MasterPrintLn("");
+
+    const auto bigN{std::min<long long>(1000ll * n, std::numeric_limits<int>::max() / 2)};
+    localIndexList.clear();
+    executor.PrintProgress(true);
+    executor(bigN, AppendIndex);
+    executor.PrintExecutionSummary();
+    CheckIndexList(bigN, localIndexList);
+    MasterPrintLn("");
+
+    localIndexList.clear();
+    executor(n, [&](auto i) {
+        AppendIndex(i);
+        std::this_thread::sleep_for(100ms);
+    });
+    executor.PrintExecutionSummary();
+    CheckIndexList(n, localIndexList);
+    MasterPrintLn("");
+
+    executor.PrintProgress(false);
+    const auto sum{executor.Reduce(bigN, 0ll, [](auto i) { return static_cast<long long>(i); }, std::plus{})};
+    if (sum != bigN * (bigN - 1) / 2) {
+        PrintError("sum != bigN * (bigN - 1) / 2");
+    }
+    const auto max{executor.Reduce(bigN, std::numeric_limits<int>::min(), std::identity{},
+                                   [](int a, int b) { return std::max(a, b); })};
+    if (max != bigN - 1) {
+        PrintError("max != bigN - 1");
+    }
+    MasterPrintLn("Reduce: sum = {}, max = {}", sum, max);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,180 @@
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Math/Random/BufferedDistribution.h++"
+#include "Mustard/Math/Random/Distribution/Exponential.h++"
+#include "Mustard/Math/Random/Distribution/Gaussian.h++"
+#include "Mustard/Math/Random/Distribution/UniformBall.h++"
+#include "Mustard/Math/Random/Distribution/UniformDisk.h++"
+#include "Mustard/Math/Random/Distribution/UniformSphere.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro256PlusPlus.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro256PlusPlusX.h++"
+
+#include "muc/array"
+#include "muc/chrono"
+#include "muc/math"
+
+#include <iostream>
+#include <tuple>
+#include <vector>
+
+using namespace Mustard;
+
+auto Report(const char* name, muc::chrono::milliseconds<double> time, const std::vector<double>& x) -> void {
+    double sum{};
+    double sum2{};
+    for (auto&& v : x) {
+        sum += v;
+        sum2 += v * v;
+    }
+    const auto mean{sum / x.size()};
+    std::cout << name << time << " (mean: " << mean << ", variance: " << sum2 / x.size() - mean * mean << ')' << std::endl;
+}
+
+template<typename T>
+auto Report(const char* name, muc::chrono::milliseconds<double> time, const std::vector<T>& x) -> void {
+    double sum{};
+    for (auto&& v : x) {
+        if constexpr (std::tuple_size_v<T> == 2) {
+            sum += muc::hypot_sq(v[0], v[1]);
+        } else {
+            sum += muc::hypot_sq(v[0], v[1], v[2]);
+        }
+    }
+    std::cout << name << time << " (mean r^2: " << sum / x.size() << ')' << std::endl;
+}
+
+auto BenchmarkVector(const char* name, auto distribution, auto& g, auto& gX4) -> void {
+    std::vector<typename decltype(distribution)::ResultType> x(4096);
+    muc::chrono::stopwatch stopwatch;
+    for (int i = 0; i < 10'000; ++i) {
+        for (auto&& v : x) {
+            v = distribution(g);
+        }
+    }
+    muc::chrono::milliseconds<double> time{stopwatch.read()};
+    std::cout << name << ", scalar";
+    Report(" : ", time, x);
+
+    stopwatch = {};
+    for (int i = 0; i < 10'000; ++i) {
+        distribution.Generate(gX4, x);
+    }
+    time = stopwatch.read();
+    std::cout << name << ", Generate (x4)";
+    Report(" : ", time, x);
+}
+
+int main() {
+    Math::Random::Xoshiro256PlusPlus xoshiro256PP;
+    Math::Random::Xoshiro256PlusPlusX4 xoshiro256PPX4;
+
+    std::cout << "Generate 4096 numbers 10k times (expected mean and variance: 1):" << std::endl;
+    std::vector<double> x(4096);
+
+    Math::Random::Exponential<double> exponential;
+    muc::chrono::stopwatch stopwatch;
+    for (int i = 0; i < 10'000; ++i) {
+        for (auto&& v : x) {
+            v = exponential(xoshiro256PP);
+        }
+    }
+    muc::chrono::milliseconds<double> time{stopwatch.read()};
+    Report("          Exponential, scalar : ", time, x);
+
+    stopwatch = {};
+    for (int i = 0; i < 10'000; ++i) {
+        exponential.Generate(xoshiro256PP, x);
+    }
+    time = stopwatch.read();
+    Report("        Exponential, Generate : ", time, x);
+
+    stopwatch = {};
+    for (int i = 0; i < 10'000; ++i) {
+        exponential.Generate(xoshiro256PPX4, x);
+    }
+    time = stopwatch.read();
+    Report("   Exponential, Generate (x4) : ", time, x);
+
+    Math::Random::ExponentialFast<double> exponentialFast;
+    stopwatch = {};
+    for (int i = 0; i < 10'000; ++i) {
+        exponentialFast.Generate(xoshiro256PPX4, x);
+    }
+    time = stopwatch.read();
+    Report("ExponentialFast, Generate (x4) : ", time, x);
+
+    Math::Random::BufferedDistribution<Math::Random::Exponential<double>> exponentialBuffered;
+    stopwatch = {};
+    for (int i = 0; i < 10'000; ++i) {
+        for (auto&& v : x) {
+            v = exponentialBuffered(xoshiro256PPX4);
+        }
+    }
+    time = stopwatch.read();
+    Report("  Exponential, buffered (x4) : ", time, x);
+
+    std::cout << "Generate 4096 numbers 10k times (expected mean: 0, variance: 1):" << std::endl;
+
+    Math::Random::Gaussian<double> gaussian;
+    stopwatch = {};
+    for (int i = 0; i < 10'000; ++i) {
+        for (auto&& v : x) {
+            v = gaussian(xoshiro256PP);
+        }
+    }
+    time = stopwatch.read();
+    Report("             Gaussian, scalar : ", time, x);
+
+    stopwatch = {};
+    for (int i = 0; i < 10'000; ++i) {
+        gaussian.Generate(xoshiro256PP, x);
+    }
+    time = stopwatch.read();
+    Report("           Gaussian, Generate : ", time, x);
+
+    stopwatch = {};
+    for (int i = 0; i < 10'000; ++i) {
+        gaussian.Generate(xoshiro256PPX4, x);
+    }
+    time = stopwatch.read();
+    Report("      Gaussian, Generate (x4) : ", time, x);
+
+    Math::Random::GaussianFast<double> gaussianFast;
+    stopwatch = {};
+    for (int i = 0; i < 10'000; ++i) {
+        gaussianFast.Generate(xoshiro256PPX4, x);
+    }
+    time = stopwatch.read();
+    Report("  GaussianFast, Generate (x4) : ", time, x);
+
+    Math::Random::BufferedDistribution<Math::Random::Gaussian<double>> gaussianBuffered;
+    stopwatch = {};
+    for (int i = 0; i < 10'000; ++i) {
+        for (auto&& v : x) {
+            v = gaussianBuffered(xoshiro256PPX4);
+        }
+    }
+    time = stopwatch.read();
+    Report("     Gaussian, buffered (x4) : ", time, x);
+
+    std::cout << "Generate 4096 vectors 10k times (expected mean r^2: 1/2, 3/5, 1):" << std::endl;
+    BenchmarkVector("  UniformDisk", Math::Random::UniformDisk<muc::array2d>{}, xoshiro256PP, xoshiro256PPX4);
+    BenchmarkVector("  UniformBall", Math::Random::UniformBall<muc::array3d>{}, xoshiro256PP, xoshiro256PPX4);
+    BenchmarkVector("UniformSphere", Math::Random::UniformSphere<muc::array3d>{}, xoshiro256PP, xoshiro256PPX4);
+
+    return 0;
+}
@@ -0,0 +1,202 @@
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Math/Random/Distribution/Discrete.h++"
+#include "Mustard/Math/Random/Distribution/Piecewise.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro256PlusPlus.h++"
+
+#include "TH1D.h"
+
+#include "muc/chrono"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+using namespace Mustard;
+
+// Pearson's chi-square of the given expected counts. Passes if chi-square is
+// within 5 sigma of its expectation.
+auto Test(const char* name, const std::vector<double>& count, const std::vector<double>& expected) -> bool {
+    auto chi2{0.};
+    auto ndf{-1};
+    for (std::size_t i{}; i < count.size(); ++i) {
+        if (expected[i] > 0) {
+            chi2 += (count[i] - expected[i]) * (count[i] - expected[i]) / expected[i];
+            ++ndf;
+        } else if (count[i] > 0) {
+            chi2 = INFINITY;
+        }
+    }
+    const auto passed{std::abs(chi2 - ndf) < 5 * std::sqrt(2. * ndf)};
+    std::cout << name << ": chi2/ndf = " << chi2 << '/' << ndf << (passed ? "  passed" : "  FAILED") << std::endl;
+    return passed;
+}
+
+// 200 bins on [a, b], with the expectation from the CDF.
+auto Validate(const char* name, int n, auto&& Sample, auto&& CDF, double a, double b) -> bool {
+    constexpr auto nBin{200};
+    std::vector<double> count(nBin);
+    std::vector<double> expected(nBin);
+    for (int i{}; i < n; ++i) {
+        const auto x{Sample()};
+        if (not(a <= x and x <= b)) {
+            std::cout << name << ": " << x << " out of range  FAILED" << std::endl;
+            return false;
+        }
+        ++count[std::min(static_cast<int>((x - a) / (b - a) * nBin), nBin - 1)];
+    }
+    for (int i{}; i < nBin; ++i) {
+        expected[i] = n * (CDF(a + (i + 1) * (b - a) / nBin) - CDF(a + i * (b - a) / nBin));
+    }
+    return Test(name, count, expected);
+}
+
+// CDF of a piecewise-linear density, exactly integrated (a piecewise-constant
+// density is the special case of equal densities at both ends).
+auto PiecewiseCDF(const std::vector<double>& x, const std::vector<double>& d0, const std::vector<double>& d1) {
+    std::vector<double> cumulative(x.size());
+    for (std::size_t i{}; i + 1 < x.size(); ++i) {
+        cumulative[i + 1] = cumulative[i] + (d0[i] + d1[i]) / 2 * (x[i + 1] - x[i]);
+    }
+    return [=](double t) {
+        if (t <= x.front()) { return 0.; }
+        if (t >= x.back()) { return 1.; }
+        const auto i{static_cast<std::size_t>(std::upper_bound(x.begin(), x.end(), t) - x.begin() - 1)};
+        const auto s{(t - x[i]) / (x[i + 1] - x[i])};
+        const auto partial{(d0[i] * s + (d1[i] - d0[i]) * s * s / 2) * (x[i + 1] - x[i])};
+        return (cumulative[i] + partial) / cumulative.back();
+    };
+}
+
+auto Time(const char* name, auto&& Sample) -> void {
+    auto sum{0.};
+    muc::chrono::stopwatch stopwatch;
+    for (int i = 0; i < 10'000'000; ++i) {
+        sum += Sample();
+    }
+    muc::chrono::milliseconds<double> time{stopwatch.read()};
+    std::cout << name << time << " (sum: " << sum << ')' << std::endl;
+}
+
+int main() {
+    Math::Random::Xoshiro256PlusPlus xoshiro256PP;
+
+    // a spectrum-like shape on [0, 10)
+    constexpr auto n{1000};
+    const auto Spectrum{[](double x) { return std::exp(-x / 3) * (1.2 + std::sin(5 * x)); }};
+    std::vector<double> x(n + 1);
+    std::vector<double> nodeDensity(n + 1);
+    std::vector<double> binDensity(n);
+    for (int i{}; i <= n; ++i) {
+        x[i] = 10. * i / n;
+        nodeDensity[i] = Spectrum(x[i]);
+    }
+    for (int i{}; i < n; ++i) {
+        binDensity[i] = Spectrum((x[i] + x[i + 1]) / 2);
+    }
+
+    std::cout << "Statistical validation:" << std::endl;
+    auto passed{true};
+
+    Math::Random::Discrete<int, n> discrete{binDensity};
+    {
+        constexpr auto nSample{10'000'000};
+        std::vector<double> count(n);
+        for (int i{}; i < nSample; ++i) {
+            ++count[discrete(xoshiro256PP)];
+        }
+        std::vector<double> expected(n);
+        const auto sum{std::reduce(binDensity.begin(), binDensity.end())};
+        for (int i{}; i < n; ++i) {
+            expected[i] = nSample * binDensity[i] / sum;
+        }
+        passed &= Test("                   Discrete", count, expected);
+    }
+    {
+        // zero weights must never come out
+        const std::array<double, 5> weight{0, 3, 0, 1, 0};
+        Math::Random::Discrete<int, 8> sparse{weight};
+        std::vector<double> count(weight.size());
+        for (int i{}; i < 1'000'000; ++i) {
+            ++count[sparse(xoshiro256PP)];
+        }
+        passed &= Test("          Discrete (sparse)", count, {0, 750'000, 0, 250'000, 0});
+    }
+
+    Math::Random::PiecewiseConstant<double, n> piecewiseConstant{x, binDensity};
+    passed &= Validate("          PiecewiseConstant", 10'000'000, [&] { return piecewiseConstant(xoshiro256PP); },
+                       PiecewiseCDF(x, binDensity, binDensity), 0, 10);
+    Math::Random::PiecewiseLinear<double, n> piecewiseLinear{x, nodeDensity};
+    passed &= Validate("            PiecewiseLinear", 10'000'000, [&] { return piecewiseLinear(xoshiro256PP); },
+                       PiecewiseCDF(x, {nodeDensity.begin(), nodeDensity.end() - 1}, {nodeDensity.begin() + 1, nodeDensity.end()}), 0, 10);
+    {
+        // a few wide intervals, to check the shape inside one
+        const std::vector<float> node{-1, 0, 2, 2.5};
+        const std::vector<float> density{0, 2, 0.5, 3};
+        Math::Random::PiecewiseLinear<float, 8> wide{node, density};
+        passed &= Validate("PiecewiseLinear<float> wide", 10'000'000, [&] { return wide(xoshiro256PP); },
+                           PiecewiseCDF({-1, 0, 2, 2.5}, {0, 2, 0.5}, {2, 0.5, 3}), -1, 2.5);
+    }
+    {
+        // zero-density intervals must never come out, nor a NaN at the zero ends
+        const std::vector<double> node{0, 1, 2, 3, 4};
+        const std::vector<double> density{0, 0, 1, 0, 0};
+        Math::Random::PiecewiseLinear<double, 8> hat{node, density};
+        passed &= Validate("   PiecewiseLinear (sparse)", 10'000'000, [&] { return hat(xoshiro256PP); },
+                           PiecewiseCDF(node, {0, 0, 1, 0}, {0, 1, 0, 0}), 0, 4);
+    }
+
+    std::cout << "Construction from TH1 and stream IO:" << std::endl;
+    {
+        TH1D histogram{"histogram", "", n, 0, 10};
+        for (int i{}; i < n; ++i) {
+            histogram.SetBinContent(i + 1, binDensity[i] * (x[i + 1] - x[i]));
+        }
+        const Math::Random::PiecewiseConstant<double, n> fromTH1{histogram};
+        std::stringstream stream;
+        stream << fromTH1;
+        Math::Random::PiecewiseConstant<double, n> restored;
+        stream >> restored;
+        Math::Random::Xoshiro256PlusPlus g1;
+        Math::Random::Xoshiro256PlusPlus g2;
+        auto same{not stream.fail()};
+        for (int i{}; i < 1000; ++i) {
+            const auto expected{piecewiseConstant(g1)};
+            same &= std::abs(restored(g2) - expected) < 1e-12;
+        }
+        std::cout << "  PiecewiseConstant" << (same ? "  passed" : "  FAILED") << std::endl;
+        passed &= same;
+    }
+
+    std::cout << "Generate 10 million numbers (" << n << " bins):" << std::endl;
+    std::discrete_distribution<int> stdDiscrete{binDensity.begin(), binDensity.end()};
+    std::piecewise_constant_distribution<double> stdPiecewiseConstant{x.begin(), x.end(), binDensity.begin()};
+    std::piecewise_linear_distribution<double> stdPiecewiseLinear{x.begin(), x.end(), nodeDensity.begin()};
+    Time("          std::discrete_distribution : ", [&] { return stdDiscrete(xoshiro256PP); });
+    Time("                            Discrete : ", [&] { return discrete(xoshiro256PP); });
+    Time("std::piecewise_constant_distribution : ", [&] { return stdPiecewiseConstant(xoshiro256PP); });
+    Time("                   PiecewiseConstant : ", [&] { return piecewiseConstant(xoshiro256PP); });
+    Time("  std::piecewise_linear_distribution : ", [&] { return stdPiecewiseLinear(xoshiro256PP); });
+    Time("                     PiecewiseLinear : ", [&] { return piecewiseLinear(xoshiro256PP); });
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
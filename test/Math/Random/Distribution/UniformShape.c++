@@ -0,0 +1,157 @@
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "Mustard/Math/Random/Distribution/Exponential.h++"
+#include "Mustard/Math/Random/Distribution/Gaussian.h++"
+#include "Mustard/Math/Random/Distribution/Joint.h++"
+#include "Mustard/Math/Random/Distribution/Uniform.h++"
+#include "Mustard/Math/Random/Distribution/UniformBall.h++"
+#include "Mustard/Math/Random/Distribution/UniformCuboid.h++"
+#include "Mustard/Math/Random/Distribution/UniformDisk.h++"
+#include "Mustard/Math/Random/Distribution/UniformRing.h++"
+#include "Mustard/Math/Random/Distribution/UniformSphere.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro256PlusPlus.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro256PlusPlusX.h++"
+
+#include "muc/array"
+#include "muc/math"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+using namespace Mustard;
+
+constexpr auto n{1'000'000};
+
+// Support, mean and mean square of each component. Both moments must be
+// within 5 standard errors (estimated from the sample) of the expectation.
+auto Test(const char* name, auto&& Sample, auto&& InSupport, muc::array3d mean, muc::array3d meanSq) -> bool {
+    muc::array3d sum{};
+    muc::array3d sumSq{};
+    muc::array3d sumSqSq{};
+    auto inSupport{true};
+    std::size_t dimension{};
+    for (int i{}; i < n; ++i) {
+        const auto r{Sample()};
+        inSupport &= InSupport(r);
+        dimension = r.size();
+        for (std::size_t j{}; j < dimension; ++j) {
+            sum[j] += r[j];
+            const auto x2{static_cast<double>(r[j]) * r[j]};
+            sumSq[j] += x2;
+            sumSqSq[j] += x2 * x2;
+        }
+    }
+    auto passed{inSupport};
+    std::cout << name << ':';
+    for (std::size_t j{}; j < dimension; ++j) {
+        const auto m{sum[j] / n};
+        const auto m2{sumSq[j] / n};
+        const auto sigma{std::sqrt(m2 - m * m)};
+        const auto sigmaSq{std::sqrt(sumSqSq[j] / n - m2 * m2)};
+        passed &= std::abs(m - mean[j]) < 5 * sigma / std::sqrt(n) and
+                  std::abs(m2 - meanSq[j]) < 5 * sigmaSq / std::sqrt(n);
+        std::cout << " (" << m << ", " << m2 << ')';
+    }
+    std::cout << (inSupport ? "" : "  out of support") << (passed ? "  passed" : "  FAILED") << std::endl;
+    return passed;
+}
+
+// Samples one by one from batches of Generate. The batch size is not a
+// multiple of the block size of the kernels.
+auto Batch(auto distribution, auto& g) {
+    return [distribution, &g, buffer = std::vector<typename decltype(distribution)::ResultType>(1001), i = std::size_t{1001}]() mutable {
+        if (i == buffer.size()) {
+            distribution.Generate(g, buffer);
+            i = 0;
+        }
+        return buffer[i++];
+    };
+}
+
+int main() {
+    Math::Random::Xoshiro256PlusPlus g;
+    Math::Random::Xoshiro256PlusPlusX4 gX4;
+    auto passed{true};
+
+    passed &= Test(
+        "UniformCompactCuboid", [&] { return Math::Random::UniformCompactCuboid<muc::array3d>{{-1, 1}, {0, 2}, {1, 4}}(g); },
+        [](auto r) { return -1 <= r[0] and r[0] <= 1 and 0 <= r[1] and r[1] <= 2 and 1 <= r[2] and r[2] <= 4; },
+        {0, 1, 2.5}, {1. / 3, 4. / 3, 7});
+    passed &= Test(
+        "UniformRealCuboid", [&] { return Math::Random::UniformCuboid<muc::array3d>{{-1, 1}, {0, 2}, {1, 4}}(g); },
+        [](auto r) { return -1 < r[0] and r[0] < 1 and 0 < r[1] and r[1] < 2 and 1 < r[2] and r[2] < 4; },
+        {0, 1, 2.5}, {1. / 3, 4. / 3, 7});
+    passed &= Test(
+        "UniformIntegerCuboid", [&] { return Math::Random::UniformCuboid<muc::array3i>{{-1, 1}, {0, 2}, {1, 4}}(g); },
+        [](auto r) { return -1 <= r[0] and r[0] <= 1 and 0 <= r[1] and r[1] <= 2 and 1 <= r[2] and r[2] <= 4; },
+        {0, 1, 2.5}, {2. / 3, 5. / 3, 7.5});
+
+    // <x^2> = r^2 / 4 for a disk, r^2 / 5 for a ball, r^2 / 3 for a sphere and
+    // r^2 / 2 for a ring. The batch kernels of Generate are tested the same.
+    const auto InDisk{[](auto r) { return muc::hypot_sq(r[0] - 1, r[1] + 1) <= 4 * (1 + 1e-15); }};
+    const auto InBall{[](auto r) { return muc::hypot_sq(r[0] - 1, r[1] + 1, r[2]) <= 4 * (1 + 1e-15); }};
+    const auto OnSphere{[](auto r) { return std::abs(std::hypot(r[0] - 1, r[1] + 1, r[2]) - 2) < 1e-12; }};
+    const auto OnRing{[](auto r) { return std::abs(std::hypot(r[0] - 1, r[1] + 1) - 2) < 1e-12; }};
+    for (auto&& batch : {false, true}) {
+        const auto Sample{[&](auto distribution) -> std::function<decltype(distribution(g))()> {
+            if (batch) {
+                return Batch(distribution, gX4);
+            }
+            return [distribution, &g]() mutable { return distribution(g); };
+        }};
+        std::cout << (batch ? "Generate:" : "operator():") << std::endl;
+        passed &= Test("  UniformCompactDisk", Sample(Math::Random::UniformCompactDisk<muc::array2d>{2, {1, -1}}),
+                       InDisk, {1, -1, 0}, {1 + 1, 1 + 1, 0});
+        passed &= Test("  UniformDisk", Sample(Math::Random::UniformDisk<muc::array2d>{2, {1, -1}}),
+                       InDisk, {1, -1, 0}, {1 + 1, 1 + 1, 0});
+        passed &= Test("  UniformCompactBall", Sample(Math::Random::UniformCompactBall<muc::array3d>{2, {1, -1, 0}}),
+                       InBall, {1, -1, 0}, {1 + 0.8, 1 + 0.8, 0.8});
+        passed &= Test("  UniformBall", Sample(Math::Random::UniformBall<muc::array3d>{2, {1, -1, 0}}),
+                       InBall, {1, -1, 0}, {1 + 0.8, 1 + 0.8, 0.8});
+        passed &= Test("  UniformSphere", Sample(Math::Random::UniformSphere<muc::array3d>{2, {1, -1, 0}}),
+                       OnSphere, {1, -1, 0}, {1 + 4. / 3, 1 + 4. / 3, 4. / 3});
+        passed &= Test("  UniformRing", Sample(Math::Random::UniformRing<muc::array2d>{2, {1, -1}}),
+                       OnRing, {1, -1, 0}, {1 + 2, 1 + 2, 0});
+    }
+
+    Math::Random::Joint<muc::array3d, Math::Random::Gaussian<double>, Math::Random::Exponential<double>, Math::Random::Uniform<double>> joint{
+        {1, 2}, {3}, {-1, 1}};
+    passed &= Test(
+        "Joint<Gaussian, Exponential, Uniform>", [&] { return joint(g); },
+        [](auto r) { return r[1] > 0 and -1 < r[2] and r[2] < 1; },
+        {1, 3, 0}, {1 + 4, 2 * 9, 1. / 3});
+
+    // parameter stream round trip, margins separated by a space
+    std::stringstream stream;
+    stream << joint.Parameter();
+    auto parameter{joint.Parameter()};
+    parameter.Parameter<0>({0, 1});
+    stream >> parameter;
+    const auto streamed{parameter == joint.Parameter()};
+    std::cout << "Joint parameter stream: " << stream.str() << (streamed ? "  passed" : "  FAILED") << std::endl;
+    passed &= streamed;
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,130 @@
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Math/Random/Distribution/Exponential.h++"
+#include "Mustard/Math/Random/Distribution/Gaussian.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro256PlusPlus.h++"
+
+#include "muc/chrono"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <numbers>
+
+using namespace Mustard;
+
+// Pearson's chi-square of 200 bins on [a, b) plus 2 overflow bins, and the
+// first 4 moments. Passes if chi-square is within 5 sigma of its expectation.
+auto Validate(const char* name, int n, auto&& Sample, auto&& CDF, double a, double b,
+              std::array<double, 4> moment) -> bool {
+    constexpr auto nBin{200};
+    std::array<double, nBin + 2> count{};
+    std::array<double, 4> sum{};
+    for (int i{}; i < n; ++i) {
+        const auto x{Sample()};
+        ++count[x < a  ? 0 :
+                x >= b ? nBin + 1 :
+                         std::min(1 + static_cast<int>((x - a) / (b - a) * nBin), nBin)];
+        for (auto power{x}; auto&& s : sum) {
+            s += power;
+            power *= x;
+        }
+    }
+    auto chi2{0.};
+    auto ndf{-1};
+    for (int i{}; i < nBin + 2; ++i) {
+        const auto low{i == 0 ? -INFINITY : a + (i - 1) * (b - a) / nBin};
+        const auto up{i == nBin + 1 ? INFINITY : a + i * (b - a) / nBin};
+        const auto expected{n * (CDF(up) - CDF(low))};
+        if (expected > 0) {
+            chi2 += (count[i] - expected) * (count[i] - expected) / expected;
+            ++ndf;
+        }
+    }
+    const auto passed{std::abs(chi2 - ndf) < 5 * std::sqrt(2. * ndf)};
+    std::cout << name << ": chi2/ndf = " << chi2 << '/' << ndf << ", moments =";
+    for (int k{}; k < 4; ++k) {
+        std::cout << ' ' << sum[k] / n << " (" << moment[k] << ')';
+    }
+    std::cout << (passed ? "  passed" : "  FAILED") << std::endl;
+    return passed;
+}
+
+auto Time(const char* name, auto&& Sample) -> void {
+    auto sum{0.};
+    muc::chrono::stopwatch stopwatch;
+    for (int i = 0; i < 10'000'000; ++i) {
+        sum += Sample();
+    }
+    muc::chrono::milliseconds<double> time{stopwatch.read()};
+    std::cout << name << time << " ms (sum: " << sum << ')' << std::endl;
+}
+
+int main() {
+    Math::Random::Xoshiro256PlusPlus xoshiro256PP;
+
+    std::cout << "Statistical validation:" << std::endl;
+    auto passed{true};
+    const auto GaussianCDF{[](double x) { return std::erfc(-x / std::numbers::sqrt2) / 2; }};
+    const auto ExponentialCDF{[](double x) { return x < 0 ? 0 : -std::expm1(-x); }};
+    Math::Random::GaussianZiggurat<double> gaussianZiggurat;
+    passed &= Validate("           GaussianZiggurat", 10'000'000, [&] { return gaussianZiggurat(xoshiro256PP); },
+                       GaussianCDF, -5, 5, {0, 1, 0, 3});
+    Math::Random::GaussianZiggurat<float> gaussianZigguratFloat;
+    passed &= Validate("    GaussianZiggurat<float>", 10'000'000, [&] { return gaussianZigguratFloat(xoshiro256PP); },
+                       GaussianCDF, -5, 5, {0, 1, 0, 3});
+    Math::Random::ExponentialZiggurat<double> exponentialZiggurat;
+    passed &= Validate("        ExponentialZiggurat", 10'000'000, [&] { return exponentialZiggurat(xoshiro256PP); },
+                       ExponentialCDF, 0, 10, {1, 2, 6, 24});
+    Math::Random::ExponentialZiggurat<float> exponentialZigguratFloat;
+    passed &= Validate(" ExponentialZiggurat<float>", 10'000'000, [&] { return exponentialZigguratFloat(xoshiro256PP); },
+                       ExponentialCDF, 0, 10, {1, 2, 6, 24});
+    // samples beyond the base layer, mostly from the tail algorithm
+    constexpr auto r{3.6541528853610088};
+    // phi(r) / Q(r), for the moments of the tail
+    const auto ratio{std::exp(-r * r / 2) * std::numbers::inv_sqrtpi * std::numbers::sqrt2 / std::erfc(r / std::numbers::sqrt2)};
+    passed &= Validate(
+        "    GaussianZiggurat (tail)", 100'000,
+        [&] {
+            auto x{gaussianZiggurat(xoshiro256PP)};
+            while (std::abs(x) < r) {
+                x = gaussianZiggurat(xoshiro256PP);
+            }
+            return x;
+        },
+        [&](double x) {
+            const auto tail{std::erfc(std::max(std::abs(x), r) / std::numbers::sqrt2) / std::erfc(r / std::numbers::sqrt2) / 2};
+            return x < 0 ? tail : 1 - tail;
+        },
+        -6, 6, {0, 1 + r * ratio, 0, 3 + (r * r * r + 3 * r) * ratio});
+
+    std::cout << "Generate 10 million numbers:" << std::endl;
+    Math::Random::Gaussian<double> gaussian;
+    Math::Random::GaussianFast<double> gaussianFast;
+    Time("           Gaussian : ", [&] { return gaussian(xoshiro256PP); });
+    Time("       GaussianFast : ", [&] { return gaussianFast(xoshiro256PP); });
+    Time("   GaussianZiggurat : ", [&] { return gaussianZiggurat(xoshiro256PP); });
+    Math::Random::Exponential<double> exponential;
+    Math::Random::ExponentialFast<double> exponentialFast;
+    Time("        Exponential : ", [&] { return exponential(xoshiro256PP); });
+    Time("    ExponentialFast : ", [&] { return exponentialFast(xoshiro256PP); });
+    Time("ExponentialZiggurat : ", [&] { return exponentialZiggurat(xoshiro256PP); });
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,98 @@
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Math/Random/Distribution/Uniform.h++"
+#include "Mustard/Math/Random/Generator/MT1993732.h++"
+#include "Mustard/Math/Random/Generator/Philox4x64.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro256PlusPlus.h++"
+
+#include "muc/chrono"
+
+#include <array>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+
+using namespace Mustard;
+
+int main() {
+    std::cout << "Known-answer test (Random123 philox4x64-10):" << std::endl;
+    const auto kat{Math::Random::Philox4x64::Block({0x243f6a8885a308d3, 0x13198a2e03707344, 0xa4093822299f31d0, 0x082efa98ec4e6c89},
+                                                   {0x452821e638d01377, 0xbe5466cf34e90c6c})};
+    const std::array<std::uint64_t, 4> expected{0xa528f45403e61d95, 0x38c72dbd566e9788, 0xa5a1610e72fd18b5, 0x57bd43b5e52b7fe6};
+    std::cout << "    " << (kat == expected ? "passed" : "FAILED") << std::endl;
+
+    std::cout << "Streams keyed by (run, task) are reproducible:" << std::endl;
+    Math::Random::Philox4x64 philox{42};
+    philox.Stream(1, 12345);
+    philox.Discard(1000);
+    const auto r1000{philox()};
+    philox.Stream(1, 12345);
+    for (int i = 0; i < 1000; ++i) {
+        philox();
+    }
+    std::cout << "    " << (philox() == r1000 ? "passed" : "FAILED") << std::endl;
+
+    Math::Random::MT1993732 mt1993732;
+    Math::Random::Xoshiro256PlusPlus xoshiro256PP;
+
+    std::cout << "Simply generate 10 million integers:" << std::endl;
+
+    auto r = mt1993732();
+    for (int i = 0; i < 1000; ++i) {
+        r = mt1993732();
+    }
+    muc::chrono::stopwatch stopwatch;
+    for (int i = 0; i < 10'000'000; ++i) {
+        r = mt1993732();
+    }
+    muc::chrono::milliseconds<double> time{stopwatch.read()};
+    std::cout << "      MT19937-32 : " << time << " ms (last integer: " << r << ')' << std::endl;
+
+    for (int i = 0; i < 1000; ++i) {
+        r = xoshiro256PP();
+    }
+    stopwatch = {};
+    for (int i = 0; i < 10'000'000; ++i) {
+        r = xoshiro256PP();
+    }
+    time = stopwatch.read();
+    std::cout << "    xoshiro256++ : " << time << " ms (last integer: " << r << ')' << std::endl;
+
+    for (int i = 0; i < 1000; ++i) {
+        r = philox();
+    }
+    stopwatch = {};
+    for (int i = 0; i < 10'000'000; ++i) {
+        r = philox();
+    }
+    time = stopwatch.read();
+    std::cout << "    Philox4x64 : " << time << " ms (last integer: " << r << ')' << std::endl;
+
+    std::cout << "Reseed per task and generate 10 doubles, 1 million tasks:" << std::endl;
+    auto sum{0.};
+    stopwatch = {};
+    for (std::uint64_t task = 0; task < 1'000'000; ++task) {
+        philox.Stream(1, task);
+        for (int i = 0; i < 10; ++i) {
+            sum += Math::Random::Uniform<double>()(philox);
+        }
+    }
+    time = stopwatch.read();
+    std::cout << "    Philox4x64 : " << time << " ms (sum: " << std::setprecision(18) << sum << std::setprecision(6) << ')' << std::endl;
+
+    return 0;
+}
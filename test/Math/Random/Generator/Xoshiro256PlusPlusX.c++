@@ -0,0 +1,106 @@
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+#include "Mustard/Math/Random/Distribution/Uniform.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro256PlusPlus.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro256PlusPlusX.h++"
+
+#include "muc/chrono"
+
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+using namespace Mustard;
+
+int main() {
+    Math::Random::Xoshiro256PlusPlus xoshiro256PP;
+    Math::Random::Xoshiro256PlusPlusX4 xoshiro256PPX4;
+    Math::Random::Xoshiro256PlusPlusX8 xoshiro256PPX8;
+
+    std::cout << "Fill is consistent with operator():" << std::endl;
+    auto copy{xoshiro256PPX4};
+    std::vector<std::uint64_t> integer(1001);
+    xoshiro256PPX4.Fill(integer);
+    auto consistent{true};
+    for (auto&& r : integer) {
+        consistent = consistent and r == copy();
+    }
+    std::cout << "    " << (consistent and copy == xoshiro256PPX4 ? "passed" : "FAILED") << std::endl;
+
+    std::cout << "Simply generate 10 million integers:" << std::endl;
+
+    auto r = xoshiro256PP();
+    for (int i = 0; i < 1000; ++i) {
+        r = xoshiro256PP();
+    }
+    muc::chrono::stopwatch stopwatch;
+    for (int i = 0; i < 10'000'000; ++i) {
+        r = xoshiro256PP();
+    }
+    muc::chrono::milliseconds<double> time{stopwatch.read()};
+    std::cout << "    xoshiro256++ : " << time << " ms (last integer: " << r << ')' << std::endl;
+
+    for (int i = 0; i < 1000; ++i) {
+        r = xoshiro256PPX4();
+    }
+    stopwatch = {};
+    for (int i = 0; i < 10'000'000; ++i) {
+        r = xoshiro256PPX4();
+    }
+    time = stopwatch.read();
+    std::cout << " xoshiro256++ x4 : " << time << " ms (last integer: " << r << ')' << std::endl;
+
+    for (int i = 0; i < 1000; ++i) {
+        r = xoshiro256PPX8();
+    }
+    stopwatch = {};
+    for (int i = 0; i < 10'000'000; ++i) {
+        r = xoshiro256PPX8();
+    }
+    time = stopwatch.read();
+    std::cout << " xoshiro256++ x8 : " << time << " ms (last integer: " << r << ')' << std::endl;
+
+    std::cout << "Fill 4096 doubles 10k times:" << std::endl;
+    std::vector<double> real(4096);
+
+    stopwatch = {};
+    for (int i = 0; i < 10'000; ++i) {
+        for (auto&& u : real) {
+            u = Math::Random::Uniform<double>()(xoshiro256PP);
+        }
+    }
+    time = stopwatch.read();
+    std::cout << "    xoshiro256++ : " << time << " ms (sum: " << std::setprecision(18) << std::reduce(real.cbegin(), real.cend()) << std::setprecision(6) << ')' << std::endl;
+
+    stopwatch = {};
+    for (int i = 0; i < 10'000; ++i) {
+        xoshiro256PPX4.Fill(real);
+    }
+    time = stopwatch.read();
+    std::cout << " xoshiro256++ x4 : " << time << " ms (sum: " << std::setprecision(18) << std::reduce(real.cbegin(), real.cend()) << std::setprecision(6) << ')' << std::endl;
+
+    stopwatch = {};
+    for (int i = 0; i < 10'000; ++i) {
+        xoshiro256PPX8.Fill(real);
+    }
+    time = stopwatch.read();
+    std::cout << " xoshiro256++ x8 : " << time << " ms (sum: " << std::setprecision(18) << std::reduce(real.cbegin(), real.cend()) << std::setprecision(6) << ')' << std::endl;
+
+    return 0;
+}
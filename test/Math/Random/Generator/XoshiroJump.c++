@@ -0,0 +1,92 @@
+// Copyright (C) 2020-2025  Mustard developers
+//
+// This file is part of Mustard, an offline software framework for HEP experiments.
+//
+// Mustard is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Mustard is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Mustard. If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro256Plus.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro256PlusPlus.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro256StarStar.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro512Plus.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro512PlusPlus.h++"
+#include "Mustard/Math/Random/Generator/Xoshiro512StarStar.h++"
+
+#include "fmt/format.h"
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <string_view>
+
+using namespace Mustard;
+
+// Reference states from the upstream jump() and long_jump() of xoshiro256**.c and
+// xoshiro512**.c (https://prng.di.unimi.it), applied to the state seeded with 1.
+// The linear engine, and so the jumps, are shared by the +, ++ and ** variants.
+
+struct Reference256 {
+    static constexpr std::array<std::uint64_t, 4> seeded{0xF5C03B0ACB413445ull, 0xA2AFF2AC4307C0D1ull, 0x0BB89E5EFA5D357Full, 0x9154C4E6E9D7BB6Eull};
+    static constexpr std::array<std::uint64_t, 4> jump{0x14BDB3043B4C78F9ull, 0x0D4E6D510BEFD432ull, 0xE6A46705CBBBB61Full, 0xCF40407A5065B453ull};
+    static constexpr std::array<std::uint64_t, 4> longJump{0xE594CB0649A067FAull, 0xF083FBF5FF9C64D4ull, 0x4DCED895A3402E51ull, 0x8FF76FB0454C9E7Eull};
+    static constexpr std::array<std::uint64_t, 4> jump3{0xC88CC96E07DE602Bull, 0xCFD30C29FEA94C44ull, 0x3340D2112C1AD85Cull, 0xEA2E99912E8BE04Aull};
+};
+
+struct Reference512 {
+    static constexpr std::array<std::uint64_t, 8> seeded{0x624BFC0994537ACBull, 0xEFBCA9B49AD90CFDull, 0x24852772D1FB17D9ull, 0x9EE5C2D28E384FF3ull,
+                                                         0x767279CFBD7A1640ull, 0x30A21B77000BED07ull, 0x3734AE1108805C23ull, 0x085730AE84F6B042ull};
+    static constexpr std::array<std::uint64_t, 8> jump{0xC769086E2B9208BBull, 0xBFAB2D5ED20F00A9ull, 0x4B0D858C7B056C72ull, 0xAF0DE72F999700DCull,
+                                                       0x9930F618192C2D27ull, 0x09CEF7E9D0961F94ull, 0x2F22730B36C89A6Eull, 0xD80EC41571D8258Bull};
+    static constexpr std::array<std::uint64_t, 8> longJump{0xEE3710E16D34C2BEull, 0x66E85887CCD4BA74ull, 0x35570CCB352A722Aull, 0x3079688D27859612ull,
+                                                           0xDEDE9408FCE401DCull, 0xDBCDC2049F13947Aull, 0xCB39E37ADBB23335ull, 0x1380DF0E1CE90D47ull};
+    static constexpr std::array<std::uint64_t, 8> jump3{0x9A90670304435ECFull, 0x659781F4B61267CCull, 0x2ED5668C89F60C93ull, 0x5B02C0477EB28ED9ull,
+                                                        0x2AC2D6087D7A8098ull, 0x2D36F8C98295F4DBull, 0xCD6A5DE94EE4DF51ull, 0xAC8EA6FC7ABB946Full};
+};
+
+template<typename AXoshiro, typename AReference>
+auto Check(std::string_view name) -> bool {
+    bool ok{true};
+    const auto Expect{[&](bool pass, std::string_view what) {
+        if (not pass) {
+            PrintError(fmt::format("{}: {}", name, what));
+            ok = false;
+        }
+    }};
+    const AXoshiro xoshiro{1};
+    Expect(xoshiro.State() == AReference::seeded, "seeded state != reference");
+
+    auto jumped{xoshiro};
+    jumped.Jump();
+    Expect(jumped.State() == AReference::jump, "Jump() != upstream jump()");
+
+    auto longJumped{xoshiro};
+    longJumped.LongJump();
+    Expect(longJumped.State() == AReference::longJump, "LongJump() != upstream long_jump()");
+
+    Expect(xoshiro.Split(0).State() == xoshiro.State(), "Split(0) != current state");
+    Expect(xoshiro.Split(1).State() == AReference::jump, "Split(1) != one jump");
+    Expect(xoshiro.Split(3).State() == AReference::jump3, "Split(3) != three jumps");
+    Expect(xoshiro.State() == AReference::seeded, "Split() modified the generator");
+    return ok;
+}
+
+int main() {
+    const auto ok{Check<Math::Random::Xoshiro256Plus, Reference256>("xoshiro256+") &
+                  Check<Math::Random::Xoshiro256PlusPlus, Reference256>("xoshiro256++") &
+                  Check<Math::Random::Xoshiro256StarStar, Reference256>("xoshiro256**") &
+                  Check<Math::Random::Xoshiro512Plus, Reference512>("xoshiro512+") &
+                  Check<Math::Random::Xoshiro512PlusPlus, Reference512>("xoshiro512++") &
+                  Check<Math::Random::Xoshiro512StarStar, Reference512>("xoshiro512**")};
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}